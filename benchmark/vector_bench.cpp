@@ -0,0 +1,625 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include <flat_set.h>
+#include <malloc_allocator.h>
+#include <ranges.h>
+#include <ring_vector.h>
+#include <small_vector.h>
+#include <soa_vector.h>
+#include <vector.h>
+
+/* ************************************************ Instrumentation ************************************************ */
+
+struct AllocationCounter {
+    static size_t allocations;
+    static size_t bytes;
+
+    static void reset() noexcept { allocations = bytes = 0; }
+};
+
+size_t AllocationCounter::allocations = 0;
+size_t AllocationCounter::bytes = 0;
+
+/**
+ * @brief Allocator counting the allocations performed through it
+ * @tparam Value type of allocated objects
+ */
+template<typename Value>
+class CountingAllocator : public std::allocator<Value> {
+public:
+    typedef Value value_type;
+
+    template<typename Other>
+    struct rebind {
+        typedef CountingAllocator<Other> other;
+    };
+
+    CountingAllocator() noexcept = default;
+
+    template<typename Other>
+    CountingAllocator(CountingAllocator<Other> const&) noexcept {}
+
+    Value* allocate(size_t const count) {
+        ++AllocationCounter::allocations;
+        AllocationCounter::bytes += count * sizeof(Value);
+
+        return std::allocator<Value>::allocate(count);
+    }
+};
+
+namespace collection {
+
+    // the construction is inherited from std::allocator so the bitwise paths stay enabled
+    template<typename Value>
+    struct uses_default_construct<CountingAllocator<Value>> : std::true_type {};
+} // namespace collection
+
+/**
+ * @brief Reports the allocations performed since the last reset per iteration of the benchmark
+ */
+static void reportAllocations(benchmark::State& state) {
+    state.counters["allocs/op"] = benchmark::Counter(static_cast<double>(AllocationCounter::allocations),
+                                                     benchmark::Counter::kAvgIterations);
+    state.counters["bytes/op"] = benchmark::Counter(static_cast<double>(AllocationCounter::bytes),
+                                                    benchmark::Counter::kAvgIterations);
+}
+
+/* ************************************************* Element types ************************************************* */
+
+/**
+ * @brief Plain type occupying a whole cache line
+ */
+struct Pod64 {
+    std::uint64_t words[8];
+};
+
+/**
+ * @brief Type holding a string similarly to {@code CustomStruct} of the showcase
+ */
+struct Record {
+    std::string text;
+    int number;
+
+    Record() : text("default text"), number(0) {}
+
+    Record(std::string text, int const number) : text(std::move(text)), number(number) {}
+};
+
+template<typename Value>
+Value makeValue(size_t index);
+
+template<>
+int makeValue<int>(size_t const index) {
+    return static_cast<int>(index);
+}
+
+template<>
+Pod64 makeValue<Pod64>(size_t const index) {
+    Pod64 value{};
+    value.words[0] = index;
+
+    return value;
+}
+
+template<>
+Record makeValue<Record>(size_t const index) {
+    return Record("record text", static_cast<int>(index));
+}
+
+inline std::uint64_t key(int const value) { return static_cast<std::uint64_t>(value); }
+
+inline std::uint64_t key(Pod64 const& value) { return value.words[0]; }
+
+inline std::uint64_t key(Record const& value) { return static_cast<std::uint64_t>(value.number); }
+
+/* *************************************************** Containers *************************************************** */
+
+template<typename Value>
+using StdVector = std::vector<Value, CountingAllocator<Value>>;
+
+template<typename Value>
+using CollectionVector = collection::Vector<Value, CountingAllocator<Value>>;
+
+template<typename Value>
+void pushBack(StdVector<Value>& vector, Value&& value) {
+    vector.push_back(std::move(value));
+}
+
+template<typename Value>
+void pushBack(CollectionVector<Value>& vector, Value&& value) {
+    vector.pushBack(std::move(value));
+}
+
+template<typename Value>
+void popBack(StdVector<Value>& vector) {
+    vector.pop_back();
+}
+
+template<typename Value>
+void popBack(CollectionVector<Value>& vector) {
+    vector.popBack();
+}
+
+template<typename Container>
+Container makeContainer(size_t const size) {
+    typedef typename Container::value_type Value;
+
+    Container container;
+    container.reserve(size);
+    for (size_t i = 0; i < size; ++i) pushBack(container, makeValue<Value>(i));
+
+    return container;
+}
+
+/* ************************************************** Benchmarks ************************************************** */
+
+template<typename Container>
+void BM_PushBack(benchmark::State& state) {
+    typedef typename Container::value_type Value;
+    auto const size = static_cast<size_t>(state.range(0));
+
+    AllocationCounter::reset();
+    for (auto _ : state) {
+        Container container;
+        for (size_t i = 0; i < size; ++i) pushBack(container, makeValue<Value>(i));
+        benchmark::DoNotOptimize(container.data());
+    }
+    reportAllocations(state);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Container>
+void BM_PushBackReserved(benchmark::State& state) {
+    typedef typename Container::value_type Value;
+    auto const size = static_cast<size_t>(state.range(0));
+
+    AllocationCounter::reset();
+    for (auto _ : state) {
+        Container container;
+        container.reserve(size);
+        for (size_t i = 0; i < size; ++i) pushBack(container, makeValue<Value>(i));
+        benchmark::DoNotOptimize(container.data());
+    }
+    reportAllocations(state);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * @brief Measures an insertion at the front followed by the removal of the last element keeping the size
+ */
+template<typename Container>
+void BM_InsertFront(benchmark::State& state) {
+    typedef typename Container::value_type Value;
+
+    auto container = makeContainer<Container>(static_cast<size_t>(state.range(0)));
+    container.reserve(container.size() + 1);
+    AllocationCounter::reset();
+    for (auto _ : state) {
+        container.insert(container.begin(), makeValue<Value>(0));
+        popBack(container);
+        benchmark::DoNotOptimize(container.data());
+    }
+    reportAllocations(state);
+}
+
+/**
+ * @brief Measures an insertion in the middle followed by the removal of the last element keeping the size
+ */
+template<typename Container>
+void BM_InsertMiddle(benchmark::State& state) {
+    typedef typename Container::value_type Value;
+
+    auto container = makeContainer<Container>(static_cast<size_t>(state.range(0)));
+    container.reserve(container.size() + 1);
+    AllocationCounter::reset();
+    for (auto _ : state) {
+        container.insert(container.begin() + container.size() / 2, makeValue<Value>(0));
+        popBack(container);
+        benchmark::DoNotOptimize(container.data());
+    }
+    reportAllocations(state);
+}
+
+/**
+ * @brief Measures an erasure of the middle half of the elements
+ */
+template<typename Container>
+void BM_EraseRange(benchmark::State& state) {
+    auto const size = static_cast<size_t>(state.range(0));
+    auto const original = makeContainer<Container>(size);
+
+    size_t allocations = 0, bytes = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto container = original;
+        AllocationCounter::reset();
+        state.ResumeTiming();
+
+        container.erase(container.begin() + size / 4, container.begin() + size / 4 + size / 2);
+        benchmark::DoNotOptimize(container.data());
+
+        state.PauseTiming();
+        allocations += AllocationCounter::allocations;
+        bytes += AllocationCounter::bytes;
+        state.ResumeTiming();
+    }
+    AllocationCounter::allocations = allocations;
+    AllocationCounter::bytes = bytes;
+    reportAllocations(state);
+}
+
+template<typename Container>
+void BM_Resize(benchmark::State& state) {
+    auto const size = static_cast<size_t>(state.range(0));
+
+    AllocationCounter::reset();
+    for (auto _ : state) {
+        Container container;
+        container.resize(size);
+        benchmark::DoNotOptimize(container.data());
+    }
+    reportAllocations(state);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Container>
+void BM_CopyConstruct(benchmark::State& state) {
+    auto const original = makeContainer<Container>(static_cast<size_t>(state.range(0)));
+
+    AllocationCounter::reset();
+    for (auto _ : state) {
+        Container copy(original);
+        benchmark::DoNotOptimize(copy.data());
+    }
+    reportAllocations(state);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * @brief Measures reassigning a buffer alternately from a full-size and a half-size original
+ * as happens to the buffers reused on every frame
+ */
+template<typename Container>
+void BM_CopyAssign(benchmark::State& state) {
+    auto const size = static_cast<size_t>(state.range(0));
+    auto const original = makeContainer<Container>(size), half = makeContainer<Container>(size / 2);
+
+    Container copy(original);
+    AllocationCounter::reset();
+    for (auto _ : state) {
+        copy = half;
+        copy = original;
+        benchmark::DoNotOptimize(copy.data());
+    }
+    reportAllocations(state);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size + size / 2));
+}
+
+/**
+ * @brief Measures a move construction and the move back into the original
+ */
+template<typename Container>
+void BM_MoveConstruct(benchmark::State& state) {
+    auto original = makeContainer<Container>(static_cast<size_t>(state.range(0)));
+
+    AllocationCounter::reset();
+    for (auto _ : state) {
+        Container moved(std::move(original));
+        benchmark::DoNotOptimize(moved.data());
+        original = std::move(moved);
+    }
+    reportAllocations(state);
+}
+
+template<typename Container>
+void BM_Iterate(benchmark::State& state) {
+    auto container = makeContainer<Container>(static_cast<size_t>(state.range(0)));
+
+    AllocationCounter::reset();
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (auto const& element : container) sum += key(element);
+        benchmark::DoNotOptimize(sum);
+    }
+    reportAllocations(state);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * @brief Sets the sizes from 1 to 10^8 elements limited so that a single container takes at most 512 MiB
+ */
+template<typename Value>
+void applySizes(benchmark::internal::Benchmark* const benchmark) {
+    constexpr size_t maxSize = (size_t{512} << 20u) / sizeof(Value);
+
+    for (size_t size = 1; size <= 100000000 && size <= maxSize; size *= 100) {
+        benchmark->Arg(static_cast<int64_t>(size));
+    }
+}
+
+/**
+ * @brief Registers all benchmarks of the container under the given name
+ * @tparam Container type of the benchmarked container
+ * @param name name of the container used in the benchmark names
+ */
+template<typename Container>
+void registerSuite(std::string const& name) {
+    typedef typename Container::value_type Value;
+    typedef void (*Benchmark)(benchmark::State&);
+
+    std::pair<char const*, Benchmark> const benchmarks[] = {
+            {"pushBack", BM_PushBack<Container>},           {"pushBackReserved", BM_PushBackReserved<Container>},
+            {"insertFront", BM_InsertFront<Container>},     {"insertMiddle", BM_InsertMiddle<Container>},
+            {"eraseRange", BM_EraseRange<Container>},       {"resize", BM_Resize<Container>},
+            {"copyConstruct", BM_CopyConstruct<Container>}, {"copyAssign", BM_CopyAssign<Container>},
+            {"moveConstruct", BM_MoveConstruct<Container>}, {"iterate", BM_Iterate<Container>},
+    };
+    for (auto const& benchmark : benchmarks) {
+        benchmark::RegisterBenchmark((std::string(benchmark.first) + '/' + name).c_str(), benchmark.second)
+                ->Apply(applySizes<Value>);
+    }
+}
+
+/**
+ * @brief Measures filling an empty vector with {@code state.range(0)} elements reporting allocations per push
+ */
+static void BM_EmptyToN(benchmark::State& state) {
+    auto const count = static_cast<size_t>(state.range(0));
+
+    AllocationCounter::reset();
+    for (auto _ : state) {
+        collection::Vector<int, CountingAllocator<int>> vector;
+        for (size_t i = 0; i < count; ++i) vector.pushBack(static_cast<int>(i));
+        benchmark::DoNotOptimize(vector.data());
+    }
+
+    auto const iterations = static_cast<double>(state.iterations());
+    state.counters["allocs/vector"] = static_cast<double>(AllocationCounter::allocations) / iterations;
+    if (count != 0) {
+        state.counters["allocs/push"]
+                = static_cast<double>(AllocationCounter::allocations) / (iterations * static_cast<double>(count));
+    }
+}
+BENCHMARK(BM_EmptyToN)->Arg(0)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->Arg(64)->Arg(1024);
+
+/**
+ * @brief Measures a miss lookup in a vector of {@code state.range(0)} small IDs
+ */
+static void BM_ContainsMiss(benchmark::State& state) {
+    auto const count = static_cast<size_t>(state.range(0));
+
+    collection::Vector<int> vector;
+    for (size_t i = 0; i < count; ++i) vector.pushBack(static_cast<int>(i));
+    auto const missing = static_cast<int>(count);
+    for (auto _ : state) benchmark::DoNotOptimize(vector.contains(missing));
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_ContainsMiss)->Arg(8)->Arg(64)->Arg(1024)->Arg(65536);
+
+/**
+ * @brief Measures summing the numbers of {@code state.range(0)} records stored as an array of structures
+ */
+static void BM_ScanFieldAoS(benchmark::State& state) {
+    auto const count = static_cast<size_t>(state.range(0));
+
+    collection::Vector<Record> records;
+    for (size_t i = 0; i < count; ++i) records.emplaceBack("record text", static_cast<int>(i));
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (auto const& record : records) sum += record.number;
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_ScanFieldAoS)->Arg(1024)->Arg(65536)->Arg(1 << 20);
+
+/**
+ * @brief Measures summing the numbers of {@code state.range(0)} records stored as a structure of arrays
+ */
+static void BM_ScanFieldSoA(benchmark::State& state) {
+    auto const count = static_cast<size_t>(state.range(0));
+
+    collection::SoAVector<std::string, int> records;
+    for (size_t i = 0; i < count; ++i) records.emplaceBack("record text", static_cast<int>(i));
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (auto const number : records.column<1>()) sum += number;
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_ScanFieldSoA)->Arg(1024)->Arg(65536)->Arg(1 << 20);
+
+/**
+ * @brief Measures passing an item through a FIFO queue of {@code state.range(0)} items built on a vector
+ */
+static void BM_QueueVector(benchmark::State& state) {
+    auto const count = static_cast<size_t>(state.range(0));
+
+    collection::Vector<int> queue;
+    for (size_t i = 0; i < count; ++i) queue.pushBack(static_cast<int>(i));
+    for (auto _ : state) {
+        auto const item = queue[0];
+        queue.erase(queue.begin());
+        queue.pushBack(item);
+        benchmark::DoNotOptimize(queue.data());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_QueueVector)->Arg(16)->Arg(1024)->Arg(65536);
+
+/**
+ * @brief Measures passing an item through a FIFO queue of {@code state.range(0)} items built on a ring vector
+ */
+static void BM_QueueRing(benchmark::State& state) {
+    auto const count = static_cast<size_t>(state.range(0));
+
+    collection::RingVector<int> queue;
+    for (size_t i = 0; i < count; ++i) queue.pushBack(static_cast<int>(i));
+    for (auto _ : state) {
+        auto const item = queue.front();
+        queue.popFront();
+        queue.pushBack(item);
+        benchmark::DoNotOptimize(&queue.back());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_QueueRing)->Arg(16)->Arg(1024)->Arg(65536);
+
+/**
+ * @brief Measures filling a small vector over a malloc-based allocator past its inline capacity
+ * which moves the elements from the inline buffer to the heap and then grows them in place
+ */
+static void BM_SmallVectorSpill(benchmark::State& state) {
+    auto const count = static_cast<int>(state.range(0));
+
+    for (auto _ : state) {
+        collection::SmallVector<int, 4, collection::MallocAllocator<int>> vector;
+        for (int i = 0; i < count; ++i) vector.pushBack(i);
+        benchmark::DoNotOptimize(vector.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_SmallVectorSpill)->Arg(4)->Arg(5)->Arg(64)->Arg(1024);
+
+/**
+ * @brief Applies the same pseudo-random inserts and erases (including empty ranges) to both vectors
+ */
+template<typename Vector>
+static void editStrings(Vector& vector, int const count) {
+    std::mt19937 random(7);
+    for (int i = 0; i < count; ++i) {
+        auto const size = vector.size(), index = random() % (size + 1), erased = random() % (size - index + 1);
+        if (random() % 2 == 0) vector.insert(vector.begin() + index, std::string(24, static_cast<char>('a' + i % 26)));
+        else vector.erase(vector.begin() + index, vector.begin() + (index + erased / 4));
+    }
+}
+
+/**
+ * @brief Measures inserting and erasing strings in the middle of a vector,
+ * the result is first checked against {@code std::vector} which fails the benchmark on a mismatch
+ */
+static void BM_EditStrings(benchmark::State& state) {
+    auto const count = static_cast<int>(state.range(0));
+
+    collection::Vector<std::string> vector;
+    std::vector<std::string> reference;
+    editStrings(vector, count);
+    editStrings(reference, count);
+    if (!std::equal(vector.begin(), vector.end(), reference.begin(), reference.end())) {
+        state.SkipWithError("the elements differ from std::vector");
+        return;
+    }
+
+    for (auto _ : state) {
+        collection::Vector<std::string> edited;
+        editStrings(edited, count);
+        benchmark::DoNotOptimize(edited.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_EditStrings)->Arg(64)->Arg(4096);
+
+/**
+ * @brief Measures random lookups of the keys present in a node-based set of {@code state.range(0)} keys
+ */
+static void BM_LookupStdSet(benchmark::State& state) {
+    auto const count = static_cast<int>(state.range(0));
+
+    std::set<int> keys;
+    for (int i = 0; i < count; ++i) keys.insert(i * 2);
+    std::minstd_rand random;
+    for (auto _ : state) benchmark::DoNotOptimize(keys.find(static_cast<int>(random() % count) * 2));
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LookupStdSet)->Arg(64)->Arg(4096)->Arg(1 << 20);
+
+/**
+ * @brief Measures random lookups of the keys present in a flat set of {@code state.range(0)} keys
+ */
+static void BM_LookupFlatSet(benchmark::State& state) {
+    auto const count = static_cast<int>(state.range(0));
+
+    collection::Vector<int> keys;
+    for (int i = 0; i < count; ++i) keys.pushBack(i * 2);
+    collection::FlatSet<int> const set(std::move(keys));
+    std::minstd_rand random;
+    for (auto _ : state) benchmark::DoNotOptimize(set.find(static_cast<int>(random() % count) * 2));
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LookupFlatSet)->Arg(64)->Arg(4096)->Arg(1 << 20);
+
+/**
+ * @brief Measures filtering and transforming {@code state.range(0)} items through an intermediate vector
+ */
+static void BM_PipelineStaged(benchmark::State& state) {
+    auto const count = static_cast<size_t>(state.range(0));
+
+    collection::Vector<int> input;
+    for (size_t i = 0; i < count; ++i) input.pushBack(static_cast<int>(i));
+    collection::Vector<int> filtered, output;
+    for (auto _ : state) {
+        filtered.clear();
+        for (auto const item : input) if (item % 3 != 0) filtered.pushBack(item);
+        output.clear();
+        for (auto const item : filtered) output.pushBack(item * 2 + 1);
+        benchmark::DoNotOptimize(output.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_PipelineStaged)->Arg(1024)->Arg(65536);
+
+/**
+ * @brief Measures filtering and transforming {@code state.range(0)} items by the fused range adapters
+ */
+static void BM_PipelineFused(benchmark::State& state) {
+    auto const count = static_cast<size_t>(state.range(0));
+
+    collection::Vector<int> input;
+    for (size_t i = 0; i < count; ++i) input.pushBack(static_cast<int>(i));
+    collection::Vector<int> output;
+    for (auto _ : state) {
+        input | collection::ranges::filter([](int const item) { return item % 3 != 0; })
+                | collection::ranges::map([](int const item) { return item * 2 + 1; })
+                | collection::ranges::collectInto(output);
+        benchmark::DoNotOptimize(output.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_PipelineFused)->Arg(1024)->Arg(65536);
+
+int main(int argc, char** argv) {
+    registerSuite<StdVector<int>>("std::vector<int>");
+    registerSuite<CollectionVector<int>>("collection::Vector<int>");
+    registerSuite<StdVector<Pod64>>("std::vector<Pod64>");
+    registerSuite<CollectionVector<Pod64>>("collection::Vector<Pod64>");
+    registerSuite<StdVector<Record>>("std::vector<Record>");
+    registerSuite<CollectionVector<Record>>("collection::Vector<Record>");
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
@@ -0,0 +1,132 @@
+#ifndef INCLUDE_ALLOCATOR_EXTENSIONS_H_
+#define INCLUDE_ALLOCATOR_EXTENSIONS_H_
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace collection {
+
+    namespace detail {
+
+        template<typename...>
+        using VoidType = void;
+
+        template<typename Allocator, typename = void>
+        struct HasTryExpand : std::false_type {};
+
+        template<typename Allocator>
+        struct HasTryExpand<Allocator, VoidType<decltype(std::declval<Allocator&>().tryExpand(
+                                               std::declval<typename std::allocator_traits<Allocator>::pointer>(),
+                                               std::declval<size_t>(), std::declval<size_t>()))>> : std::true_type {};
+
+        template<typename Allocator, typename = void>
+        struct HasReallocate : std::false_type {};
+
+        template<typename Allocator>
+        struct HasReallocate<Allocator, VoidType<decltype(std::declval<Allocator&>().reallocate(
+                                                std::declval<typename std::allocator_traits<Allocator>::pointer>(),
+                                                std::declval<size_t>(), std::declval<size_t>()))>> : std::true_type {};
+
+        template<typename Allocator, typename = void>
+        struct HasConstruct : std::false_type {};
+
+        template<typename Allocator>
+        struct HasConstruct<Allocator, VoidType<decltype(std::declval<Allocator&>().construct(
+                                               std::declval<typename std::allocator_traits<Allocator>::pointer>(),
+                                               std::declval<typename Allocator::value_type const&>()))>>
+            : std::true_type {};
+    } // namespace detail
+
+    /**
+     * @brief Tells whether the allocator constructs objects by plain placement-new
+     * so that containers may initialize trivially copyable objects by copying their bytes
+     *
+     * @tparam Allocator type of the allocator
+     *
+     * @note this should be specialized for allocators whose {@code construct} is inherited from {@code std::allocator}
+     */
+    template<typename Allocator>
+    struct uses_default_construct
+        : std::integral_constant<bool, !detail::HasConstruct<Allocator>::value
+                                               || std::is_same<Allocator, std::allocator<
+                                                                                  typename Allocator::value_type>>::value> {
+    };
+
+    /**
+     * @brief Uniform access to the optional allocator protocol allowing in-place and realloc-style growth
+     *
+     * An allocator may provide any of the following members:
+     * <ul>
+     *     <li>{@code bool tryExpand(pointer, size_t oldCapacity, size_t newCapacity)} which extends the block
+     *     without moving it and returns {@code true} on success or {@code false} if the block is left untouched</li>
+     *     <li>{@code pointer reallocate(pointer, size_t oldCapacity, size_t newCapacity)} which resizes the block
+     *     possibly moving its contents bytewise (so it is only used for trivially relocatable types)</li>
+     * </ul>
+     * Missing members are detected at compile time and replaced with no-op fallbacks
+     * similarly to {@code std::allocator_traits}.
+     *
+     * @tparam Allocator type of the allocator
+     */
+    template<typename Allocator>
+    struct AllocatorExtensions {
+        typedef typename std::allocator_traits<Allocator>::pointer Pointer;
+
+        static constexpr bool canTryExpand = detail::HasTryExpand<Allocator>::value;
+
+        static constexpr bool canReallocate = detail::HasReallocate<Allocator>::value;
+
+    private:
+        static bool tryExpand(Allocator& allocator, Pointer const pointer, size_t const oldCapacity,
+                              size_t const newCapacity, std::true_type) {
+            return allocator.tryExpand(pointer, oldCapacity, newCapacity);
+        }
+
+        static bool tryExpand(Allocator&, Pointer, size_t, size_t, std::false_type) noexcept { return false; }
+
+        static Pointer reallocate(Allocator& allocator, Pointer const pointer, size_t const oldCapacity,
+                                  size_t const newCapacity, std::true_type) {
+            return allocator.reallocate(pointer, oldCapacity, newCapacity);
+        }
+
+    public:
+        /**
+         * @brief Attempts to extend the allocated block without moving it
+         * @param allocator allocator which has allocated the block
+         * @param pointer pointer to the allocated block
+         * @param oldCapacity number of objects for which the block was allocated
+         * @param newCapacity number of objects for which the block should be extended
+         * @return {@code true} if the block now fits {@code newCapacity} objects and {@code false} otherwise
+         */
+        static bool tryExpand(Allocator& allocator, Pointer const pointer, size_t const oldCapacity,
+                              size_t const newCapacity) {
+            return tryExpand(allocator, pointer, oldCapacity, newCapacity, detail::HasTryExpand<Allocator>{});
+        }
+
+        /**
+         * @brief Resizes the allocated block possibly moving its contents bytewise to a new location
+         * @param allocator allocator which has allocated the block
+         * @param pointer pointer to the allocated block
+         * @param oldCapacity number of objects for which the block was allocated
+         * @param newCapacity number of objects for which the block should be reallocated
+         * @return pointer to the reallocated block
+         *
+         * @note this is only available if {@link #canReallocate} is {@code true}
+         */
+        static Pointer reallocate(Allocator& allocator, Pointer const pointer, size_t const oldCapacity,
+                                  size_t const newCapacity) {
+            static_assert(canReallocate, "Allocator does not provide `reallocate`");
+
+            return reallocate(allocator, pointer, oldCapacity, newCapacity, detail::HasReallocate<Allocator>{});
+        }
+    };
+
+    template<typename Allocator>
+    constexpr bool AllocatorExtensions<Allocator>::canTryExpand;
+
+    template<typename Allocator>
+    constexpr bool AllocatorExtensions<Allocator>::canReallocate;
+} // namespace collection
+
+#endif //INCLUDE_ALLOCATOR_EXTENSIONS_H_
@@ -0,0 +1,179 @@
+#ifndef INCLUDE_ARENA_ALLOCATOR_H_
+#define INCLUDE_ARENA_ALLOCATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace collection {
+
+    /**
+     * @brief Monotonic memory resource handing out memory by bumping a pointer inside big chunks
+     * which are all released at once
+     *
+     * @note this is not thread-safe, an arena is expected to be owned by a single request
+     */
+    class Arena {
+        /**
+         * @brief Header of the chunk followed by its memory
+         */
+        struct alignas(std::max_align_t) Chunk {
+            Chunk* previous;
+            size_t size;
+        };
+
+        Chunk* chunk_;
+        char* cursor_;
+        char* end_;
+        size_t nextChunkSize_;
+
+        static char* align(char* const pointer, size_t const alignment) noexcept {
+            auto const address = reinterpret_cast<std::uintptr_t>(pointer);
+
+            return pointer + ((alignment - address % alignment) % alignment);
+        }
+
+        void addChunk(size_t const minimalSize) {
+            constexpr auto maximalSize = std::numeric_limits<size_t>::max() - sizeof(Chunk);
+
+            auto size = nextChunkSize_;
+            while (size < minimalSize) {
+                // doubling past the half of the address space would wrap around and never reach the minimal size
+                if (size > maximalSize / 2) throw std::bad_alloc();
+                size <<= 1u;
+            }
+            if (size > maximalSize) throw std::bad_alloc();
+
+            auto const chunk = static_cast<Chunk*>(::operator new(sizeof(Chunk) + size));
+            chunk->previous = chunk_;
+            chunk->size = size;
+
+            chunk_ = chunk;
+            cursor_ = reinterpret_cast<char*>(chunk + 1);
+            end_ = cursor_ + size;
+            // chunks grow geometrically so that big arenas consist of few chunks
+            nextChunkSize_ = size > maximalSize / 2 ? size : size << 1u;
+        }
+
+    public:
+        static constexpr size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+        /**
+         * @brief Creates an arena which does not allocate any memory until it is required
+         * @param initialChunkSize size of the first allocated chunk in bytes
+         */
+        explicit Arena(size_t const initialChunkSize = DEFAULT_CHUNK_SIZE) noexcept
+            : chunk_(nullptr), cursor_(nullptr), end_(nullptr),
+              nextChunkSize_(initialChunkSize == 0 ? size_t{DEFAULT_CHUNK_SIZE} : initialChunkSize) {}
+
+        Arena(Arena const&) = delete;
+
+        Arena& operator=(Arena const&) = delete;
+
+        ~Arena() { release(); }
+
+        /**
+         * @brief Allocates a memory block which lives until the arena gets released
+         * @param bytes size of the block in bytes
+         * @param alignment alignment of the block, should be a power of two
+         * @return pointer to the allocated block
+         */
+        void* allocate(size_t const bytes, size_t const alignment) {
+            auto aligned = cursor_ == nullptr ? nullptr : align(cursor_, alignment);
+            if (aligned == nullptr || aligned > end_ || bytes > static_cast<size_t>(end_ - aligned)) {
+                if (bytes > std::numeric_limits<size_t>::max() - alignment) throw std::bad_alloc();
+                addChunk(bytes + alignment);
+                aligned = align(cursor_, alignment);
+            }
+            cursor_ = aligned + bytes;
+
+            return aligned;
+        }
+
+        /**
+         * @brief Attempts to extend the block without moving it which is possible if it is the last allocated one
+         * @param pointer pointer to the allocated block
+         * @param oldBytes size of the block in bytes
+         * @param newBytes required size of the block in bytes
+         * @return {@code true} if the block has been extended and {@code false} otherwise
+         */
+        bool tryExpand(void* const pointer, size_t const oldBytes, size_t const newBytes) noexcept {
+            auto const block = static_cast<char*>(pointer);
+            if (block + oldBytes != cursor_ || newBytes > static_cast<size_t>(end_ - block)) return false;
+
+            cursor_ = block + newBytes;
+
+            return true;
+        }
+
+        /**
+         * @brief Releases all memory allocated by this arena invalidating all the allocated blocks
+         */
+        void release() noexcept {
+            while (chunk_ != nullptr) {
+                auto const previous = chunk_->previous;
+                ::operator delete(chunk_);
+                chunk_ = previous;
+            }
+            cursor_ = end_ = nullptr;
+        }
+    };
+
+    /**
+     * @brief Allocator taking memory from an {@link Arena} so that deallocation is a no-op
+     * and the memory gets released in bulk together with the arena
+     *
+     * @tparam Value type of allocated objects
+     *
+     * @note similarly to polymorphic allocators this does not propagate on container assignment or swap
+     * so that the containers never outlive their arenas by taking each other's allocator
+     */
+    template<typename Value>
+    class ArenaAllocator {
+        template<typename Other>
+        friend class ArenaAllocator;
+
+        Arena* arena_;
+
+    public:
+        typedef Value value_type;
+        typedef std::false_type propagate_on_container_copy_assignment;
+        typedef std::false_type propagate_on_container_move_assignment;
+        typedef std::false_type propagate_on_container_swap;
+        typedef std::false_type is_always_equal;
+
+        ArenaAllocator(Arena& arena) noexcept : arena_(&arena) {}
+
+        template<typename Other>
+        ArenaAllocator(ArenaAllocator<Other> const& original) noexcept : arena_(original.arena_) {}
+
+        Arena& arena() const noexcept { return *arena_; }
+
+        Value* allocate(size_t const count) {
+            if (count > std::numeric_limits<size_t>::max() / sizeof(Value)) throw std::bad_alloc();
+
+            return static_cast<Value*>(arena_->allocate(count * sizeof(Value), alignof(Value)));
+        }
+
+        void deallocate(Value*, size_t) noexcept {}
+
+        bool tryExpand(Value* const pointer, size_t const oldCapacity, size_t const newCapacity) noexcept {
+            return newCapacity <= std::numeric_limits<size_t>::max() / sizeof(Value)
+                   && arena_->tryExpand(pointer, oldCapacity * sizeof(Value), newCapacity * sizeof(Value));
+        }
+
+        template<typename Other>
+        bool operator==(ArenaAllocator<Other> const& other) const noexcept {
+            return arena_ == other.arena_;
+        }
+
+        template<typename Other>
+        bool operator!=(ArenaAllocator<Other> const& other) const noexcept {
+            return arena_ != other.arena_;
+        }
+    };
+} // namespace collection
+
+#endif //INCLUDE_ARENA_ALLOCATOR_H_
@@ -0,0 +1,244 @@
+#ifndef INCLUDE_CHECKS_H_
+#define INCLUDE_CHECKS_H_
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+/*
+ * COLLECTION_VECTOR_CHECKS selects the checks performed by the vectors:
+ *
+ * 0 - only the explicitly checked accessors (such as at()) validate their arguments,
+ *     the positions passed to insert(), emplace(), erase() and swapErase() as well as popBack() are trusted
+ * 1 - (default) additionally the positions get validated and popBack() of an empty vector throws
+ * 2 - additionally operator[] validates the index and the iterators are checked so that dereferencing an iterator
+ *     invalidated by reallocation or pointing outside the elements (e.g. after popBack()) throws
+ *
+ * The level changes the iterator types so it should be the same in all translation units.
+ */
+#ifndef COLLECTION_VECTOR_CHECKS
+#define COLLECTION_VECTOR_CHECKS 1
+#endif
+
+/*
+ * COLLECTION_COLD marks the functions which only get called on errors
+ * so that they are kept out of the hot code and never get inlined into it.
+ */
+#if defined(__GNUC__)
+#define COLLECTION_COLD __attribute__((cold, noinline))
+#else
+#define COLLECTION_COLD
+#endif
+
+namespace collection {
+
+    namespace detail {
+
+        /* *********************************************** Exceptions *********************************************** */
+
+        [[noreturn]] COLLECTION_COLD inline void throwOutOfRange(size_t const index, size_t const size) {
+            throw std::out_of_range("Index " + std::to_string(index) + " should be < size " + std::to_string(size));
+        }
+
+        [[noreturn]] COLLECTION_COLD inline void throwOutOfRangeEmpty() { throw std::out_of_range("Vector is empty"); }
+
+        [[noreturn]] COLLECTION_COLD inline void throwOffsetOutOfRange(size_t const offset, size_t const size) {
+            throw std::out_of_range("Offset " + std::to_string(offset) + " should be <= size " + std::to_string(size));
+        }
+
+        [[noreturn]] COLLECTION_COLD inline void throwRangeError(char const* const message) {
+            throw std::range_error(message);
+        }
+
+        [[noreturn]] COLLECTION_COLD inline void throwLogicError(char const* const message) {
+            throw std::logic_error(message);
+        }
+
+        [[noreturn]] COLLECTION_COLD inline void throwLengthError(size_t const requiredSize) {
+            throw std::length_error("Vector cannot hold " + std::to_string(requiredSize) + " elements");
+        }
+
+        [[noreturn]] COLLECTION_COLD inline void throwLengthError(char const* const message) {
+            throw std::length_error(message);
+        }
+
+        [[noreturn]] COLLECTION_COLD inline void throwInvalidIterator(char const* const message) {
+            throw std::logic_error(message);
+        }
+
+        [[noreturn]] COLLECTION_COLD inline void throwIteratorOutOfRange() {
+            throw std::out_of_range("Iterator does not point to an element");
+        }
+
+        /**
+         * @brief Iterator over the elements of a vector checking that it is still valid whenever it is used
+         * @tparam Value type of the pointed value, it is const-qualified for read-only iterators
+         * @tparam Owner type of the vector providing {@code data()}, {@code size()}
+         * and the {@code generation_} of its array
+         *
+         * @note the iterator remembers the generation of the vector's array so it gets invalidated by any reallocation
+         * even if the array happens to be allocated at the same address afterwards
+         */
+        template<typename Value, typename Owner>
+        class CheckedIterator {
+            template<typename, typename>
+            friend class CheckedIterator;
+
+            typedef typename std::remove_const<Value>::type Element;
+
+            Owner const* owner_;
+            Element const* base_;
+            size_t generation_;
+            Value* current_;
+
+            void checkValid() const {
+                if (owner_ == nullptr) throwInvalidIterator("Iterator does not belong to a vector");
+                if (owner_->generation_ != generation_) {
+                    throwInvalidIterator("Iterator has been invalidated by reallocation");
+                }
+            }
+
+            void checkDereferenceable(Value* const pointer) const {
+                checkValid();
+                if (pointer < base_ || pointer >= base_ + owner_->size()) throwIteratorOutOfRange();
+            }
+
+            void checkComparable(CheckedIterator const& other) const {
+                if (owner_ != other.owner_) throwInvalidIterator("Iterators belong to different vectors");
+            }
+
+        public:
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef Element value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef Value* pointer;
+            typedef Value& reference;
+
+            constexpr CheckedIterator() noexcept : owner_(nullptr), base_(nullptr), generation_(0), current_(nullptr) {}
+
+            CheckedIterator(Owner const* const owner, Value* const current) noexcept
+                : owner_(owner), base_(owner->data()), generation_(owner->generation_), current_(current) {}
+
+            /**
+             * @brief Converts the mutable iterator to the read-only one
+             */
+            template<typename Other,
+                     typename = typename std::enable_if<std::is_same<Value, Other const>::value
+                                                        && !std::is_same<Value, Other>::value>::type>
+            CheckedIterator(CheckedIterator<Other, Owner> const& other) noexcept
+                : owner_(other.owner_), base_(other.base_), generation_(other.generation_), current_(other.current_) {}
+
+            /**
+             * @brief Gets the pointer to the element checking that this iterator is valid for the given vector.
+             * @param owner vector which this iterator should belong to
+             * @return pointer to the pointed element which may be the end of the elements
+             */
+            Value* pointerIn(Owner const* const owner) const {
+                if (owner != owner_) throwInvalidIterator("Iterator belongs to another vector");
+                checkValid();
+
+                return current_;
+            }
+
+            reference operator*() const {
+                checkDereferenceable(current_);
+
+                return *current_;
+            }
+
+            pointer operator->() const {
+                checkDereferenceable(current_);
+
+                return current_;
+            }
+
+            reference operator[](difference_type const offset) const {
+                checkDereferenceable(current_ + offset);
+
+                return current_[offset];
+            }
+
+            CheckedIterator& operator++() noexcept {
+                ++current_;
+                return *this;
+            }
+
+            CheckedIterator operator++(int) noexcept {
+                auto const previous = *this;
+                ++current_;
+
+                return previous;
+            }
+
+            CheckedIterator& operator--() noexcept {
+                --current_;
+                return *this;
+            }
+
+            CheckedIterator operator--(int) noexcept {
+                auto const previous = *this;
+                --current_;
+
+                return previous;
+            }
+
+            CheckedIterator& operator+=(difference_type const offset) noexcept {
+                current_ += offset;
+                return *this;
+            }
+
+            CheckedIterator& operator-=(difference_type const offset) noexcept {
+                current_ -= offset;
+                return *this;
+            }
+
+            friend CheckedIterator operator+(CheckedIterator iterator, difference_type const offset) noexcept {
+                return iterator += offset;
+            }
+
+            friend CheckedIterator operator+(difference_type const offset, CheckedIterator iterator) noexcept {
+                return iterator += offset;
+            }
+
+            friend CheckedIterator operator-(CheckedIterator iterator, difference_type const offset) noexcept {
+                return iterator -= offset;
+            }
+
+            friend difference_type operator-(CheckedIterator const& left, CheckedIterator const& right) {
+                left.checkComparable(right);
+
+                return left.current_ - right.current_;
+            }
+
+            friend bool operator==(CheckedIterator const& left, CheckedIterator const& right) {
+                left.checkComparable(right);
+
+                return left.current_ == right.current_;
+            }
+
+            friend bool operator!=(CheckedIterator const& left, CheckedIterator const& right) {
+                return !(left == right);
+            }
+
+            friend bool operator<(CheckedIterator const& left, CheckedIterator const& right) {
+                left.checkComparable(right);
+
+                return left.current_ < right.current_;
+            }
+
+            friend bool operator<=(CheckedIterator const& left, CheckedIterator const& right) {
+                return !(right < left);
+            }
+
+            friend bool operator>(CheckedIterator const& left, CheckedIterator const& right) { return right < left; }
+
+            friend bool operator>=(CheckedIterator const& left, CheckedIterator const& right) {
+                return !(left < right);
+            }
+        };
+    } // namespace detail
+} // namespace collection
+
+#endif //INCLUDE_CHECKS_H_
@@ -0,0 +1,34 @@
+#ifndef INCLUDE_COMPACT_VECTOR_H_
+#define INCLUDE_COMPACT_VECTOR_H_
+
+#include <cstdint>
+#include <memory>
+
+#include <growth_policy.h>
+#include <vector.h>
+
+namespace collection {
+
+    /**
+     * @brief Vector storing its size and capacity in a narrower type so that it takes less space
+     * when many small vectors are kept (e.g. as values of maps or in adjacency lists)
+     *
+     * @tparam Value type of stored value
+     * @tparam SizeType unsigned type used to store the size and the capacity
+     * @tparam Allocator type of used allocator
+     * @tparam GrowthPolicy policy deciding on the capacity of the allocated arrays
+     *
+     * @note inserting more than {@code maxSize()} elements throws {@code std::length_error}
+     */
+    template<typename Value, typename SizeType = std::uint32_t, typename Allocator = std::allocator<Value>,
+             typename GrowthPolicy = DefaultGrowthPolicy>
+    using CompactVector = Vector<Value, Allocator, GrowthPolicy, SizeType>;
+
+    // the checked iterators additionally need the generation of the array
+    static_assert(sizeof(CompactVector<std::uint32_t>)
+                          == sizeof(void*) + 2 * sizeof(std::uint32_t)
+                                     + (COLLECTION_VECTOR_CHECKS >= 2 ? sizeof(size_t) : 0),
+                  "CompactVector should consist of a pointer and two 32-bit counters");
+} // namespace collection
+
+#endif //INCLUDE_COMPACT_VECTOR_H_
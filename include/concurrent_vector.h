@@ -0,0 +1,343 @@
+#ifndef INCLUDE_CONCURRENT_VECTOR_H_
+#define INCLUDE_CONCURRENT_VECTOR_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+#include <vector.h>
+
+namespace collection {
+
+    /**
+     * @brief Append-only vector which may be appended to by multiple threads concurrently
+     *
+     * The elements are stored in buckets whose sizes are successive powers of two so that they never move
+     * and the index of an element stays valid (and its reference stable) until the vector gets destroyed.
+     * Appending takes a single atomic increment in the common case and a bucket allocation published by CAS
+     * once per bucket, access by index takes no synchronization at all.
+     *
+     * @tparam Value type of stored value
+     * @tparam Allocator type of allocator used for the buckets, it should be safe to call concurrently
+     *
+     * @note an element becomes visible to other threads only through the synchronization with the thread
+     * which has appended it (e.g. by joining it or by an atomic flag), {@link #size()} only tells
+     * the number of reserved indices some of which may still be under construction
+     */
+    template<typename Value, typename Allocator = std::allocator<Value>>
+    class ConcurrentVector : protected detail::AllocatorHolder<Allocator> {
+        typedef detail::AllocatorHolder<Allocator> AllocatorHolder;
+
+    protected:
+        using AllocatorHolder::allocator;
+
+    public:
+        typedef Value ValueType;
+        typedef Value& reference;
+        typedef Value const& ConstReference;
+        typedef Value* Pointer;
+        typedef Allocator AllocatorType;
+        typedef std::allocator_traits<AllocatorType> Memory;
+
+        static constexpr size_t FIRST_BUCKET_SIZE_LOG = 4;
+
+        static constexpr size_t FIRST_BUCKET_SIZE = size_t{1} << FIRST_BUCKET_SIZE_LOG;
+
+        static constexpr size_t BUCKET_COUNT = sizeof(size_t) * 8 - FIRST_BUCKET_SIZE_LOG;
+
+    protected:
+        /**
+         * @brief Location of the element, the bucket {@code b} holds the indices
+         * starting at {@code FIRST_BUCKET_SIZE * (2^b - 1)}
+         */
+        struct Location {
+            size_t bucket, offset;
+        };
+
+        std::atomic<Pointer> buckets_[BUCKET_COUNT];
+        std::atomic<size_t> size_;
+
+        /**
+         * @brief Ranges of indices whose elements have failed to get constructed, they are rare
+         * so they are guarded by a plain mutex
+         */
+        Vector<std::pair<size_t, size_t>> failures_;
+        mutable std::mutex failuresMutex_;
+
+        /* ************************************************* Layout ************************************************* */
+
+        static size_t log2(size_t const value) noexcept {
+#if defined(__GNUC__)
+            return sizeof(unsigned long long) * 8 - 1 - static_cast<size_t>(__builtin_clzll(value));
+#else
+            size_t result = 0;
+            while ((value >> result) > 1) ++result;
+
+            return result;
+#endif
+        }
+
+        static constexpr size_t bucketSize(size_t const bucket) noexcept { return FIRST_BUCKET_SIZE << bucket; }
+
+        static constexpr size_t bucketStart(size_t const bucket) noexcept {
+            return bucketSize(bucket) - FIRST_BUCKET_SIZE;
+        }
+
+        static Location locate(size_t const index) noexcept {
+            auto const shifted = index + FIRST_BUCKET_SIZE;
+            auto const bucket = log2(shifted) - FIRST_BUCKET_SIZE_LOG;
+
+            return {bucket, shifted - bucketSize(bucket)};
+        }
+
+        /* ************************************************* Buckets ************************************************ */
+
+        /**
+         * @brief Gets the bucket allocating it if it has not yet been allocated
+         * @param bucket index of the bucket
+         * @return pointer to the bucket's memory
+         *
+         * @note concurrent allocations race via CAS and the losers release their buckets
+         */
+        Pointer requireBucket(size_t const bucket) {
+            auto current = buckets_[bucket].load(std::memory_order_acquire);
+            if (current != nullptr) return current;
+
+            auto const allocated = Memory::allocate(allocator(), bucketSize(bucket));
+            if (buckets_[bucket].compare_exchange_strong(current, allocated, std::memory_order_acq_rel,
+                                                         std::memory_order_acquire)) {
+                return allocated;
+            }
+            Memory::deallocate(allocator(), allocated, bucketSize(bucket));
+
+            return current;
+        }
+
+        /**
+         * @brief Reserves the range of indices allocating all buckets it spans
+         * @param count number of reserved indices
+         * @return first reserved index
+         */
+        size_t reserveIndices(size_t const count) {
+            auto const first = size_.fetch_add(count, std::memory_order_relaxed);
+            if (count != 0) {
+                auto const last = locate(first + count - 1).bucket;
+                try {
+                    for (auto bucket = locate(first).bucket; bucket <= last; ++bucket) requireBucket(bucket);
+                } catch (...) {
+                    markFailed(first, count);
+                    throw;
+                }
+            }
+
+            return first;
+        }
+
+        /**
+         * @brief Remembers that the range of indices has got no constructed elements
+         * @param first first index of the range
+         * @param count number of indices in the range
+         */
+        void markFailed(size_t const first, size_t const count) {
+            std::lock_guard<std::mutex> const lock(failuresMutex_);
+            failures_.emplaceBack(first, count);
+        }
+
+        /**
+         * @brief Calls the operation for each contiguous run of elements in the range
+         * @param first first index of the range
+         * @param count number of indices in the range
+         * @param operation operation called with pointers to the first and the last elements of each run
+         */
+        template<typename Operation>
+        void forEachRun(size_t first, size_t count, Operation operation) const {
+            while (count != 0) {
+                auto const location = locate(first);
+                auto const bucket = buckets_[location.bucket].load(std::memory_order_acquire);
+                auto const runSize = std::min(count, bucketSize(location.bucket) - location.offset);
+                operation(bucket + location.offset, bucket + location.offset + runSize);
+                first += runSize;
+                count -= runSize;
+            }
+        }
+
+        /**
+         * @brief Calls the operation for each contiguous run of constructed elements
+         * @param operation operation called with pointers to the first and the last elements of each run
+         *
+         * @note this should not be called concurrently with appending
+         */
+        template<typename Operation>
+        void forEachConstructedRun(Operation operation) const {
+            std::lock_guard<std::mutex> const lock(failuresMutex_);
+            auto failures = failures_;
+            std::sort(failures.begin(), failures.end());
+
+            size_t next = 0;
+            for (auto const& failure : failures) {
+                forEachRun(next, failure.first - next, operation);
+                next = failure.first + failure.second;
+            }
+            forEachRun(next, size_.load(std::memory_order_acquire) - next, operation);
+        }
+
+    public:
+        /* ********************************************** Constructors ********************************************** */
+
+        ConcurrentVector() : ConcurrentVector(AllocatorType()) {}
+
+        /**
+         * @brief Creates a new empty vector using the given allocator.
+         * @param allocator allocator used for the buckets
+         */
+        explicit ConcurrentVector(AllocatorType const& allocator) : AllocatorHolder(allocator), size_(0) {
+            for (auto& bucket : buckets_) bucket.store(nullptr, std::memory_order_relaxed);
+        }
+
+        ConcurrentVector(ConcurrentVector const&) = delete;
+
+        ConcurrentVector& operator=(ConcurrentVector const&) = delete;
+
+        ~ConcurrentVector() {
+            forEachConstructedRun([this](Pointer first, Pointer const last) {
+                for (; first != last; ++first) Memory::destroy(allocator(), first);
+            });
+            for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+                auto const pointer = buckets_[bucket].load(std::memory_order_relaxed);
+                if (pointer != nullptr) Memory::deallocate(allocator(), pointer, bucketSize(bucket));
+            }
+        }
+
+        /* ********************************************** Modification ********************************************** */
+
+        /**
+         * @brief Constructs a new element at the end of the vector.
+         * @param arguments arguments forwarded to the element's constructor
+         * @return index of the constructed element
+         *
+         * @note the index does not get reused if the constructor throws
+         */
+        template<typename... Arguments>
+        size_t emplaceBack(Arguments&&... arguments) {
+            auto const index = reserveIndices(1);
+            auto const location = locate(index);
+            try {
+                Memory::construct(allocator(), buckets_[location.bucket].load(std::memory_order_acquire)
+                                                       + location.offset,
+                                  std::forward<Arguments>(arguments)...);
+            } catch (...) {
+                markFailed(index, 1);
+                throw;
+            }
+
+            return index;
+        }
+
+        size_t pushBack(ConstReference value) { return emplaceBack(value); }
+
+        size_t pushBack(Value&& value) { return emplaceBack(std::move(value)); }
+
+        /**
+         * @brief Appends the given number of copies of the value reserving a contiguous range of indices
+         * so that a thread may write a batch of elements without further synchronization.
+         * @param count number of appended elements
+         * @param value value to be copied
+         * @return index of the first appended element
+         *
+         * @note if any of the copies cannot be constructed, none of them are kept
+         */
+        size_t growBy(size_t const count, ConstReference value) {
+            auto const first = reserveIndices(count);
+            size_t constructed = 0;
+            try {
+                forEachRun(first, count, [this, &value, &constructed](Pointer element, Pointer const last) {
+                    for (; element != last; ++element, ++constructed) Memory::construct(allocator(), element, value);
+                });
+            } catch (...) {
+                forEachRun(first, constructed, [this](Pointer element, Pointer const last) {
+                    for (; element != last; ++element) Memory::destroy(allocator(), element);
+                });
+                markFailed(first, count);
+                throw;
+            }
+
+            return first;
+        }
+
+        /**
+         * @brief Appends the given number of value-initialized elements reserving a contiguous range of indices.
+         * @param count number of appended elements
+         * @return index of the first appended element
+         */
+        size_t growBy(size_t const count) { return growBy(count, ValueType()); }
+
+        /**
+         * @brief Allocates the buckets needed to hold the given number of elements.
+         * @param capacity number of elements which should fit without further allocations
+         */
+        void reserve(size_t const capacity) {
+            if (capacity == 0) return;
+
+            auto const last = locate(capacity - 1).bucket;
+            for (size_t bucket = 0; bucket <= last; ++bucket) requireBucket(bucket);
+        }
+
+        /* ********************************************* Data accessors ********************************************* */
+
+        /**
+         * @brief Gets the appended element.
+         * @param index index of the element returned by one of the appending methods
+         * @return reference to the element which stays valid until this vector gets destroyed
+         */
+        reference operator[](size_t const index) noexcept {
+            auto const location = locate(index);
+
+            return buckets_[location.bucket].load(std::memory_order_acquire)[location.offset];
+        }
+
+        ConstReference operator[](size_t const index) const noexcept {
+            auto const location = locate(index);
+
+            return buckets_[location.bucket].load(std::memory_order_acquire)[location.offset];
+        }
+
+        /**
+         * @brief Gets the number of reserved indices including the ones whose elements are under construction.
+         */
+        size_t size() const noexcept { return size_.load(std::memory_order_acquire); }
+
+        bool empty() const noexcept { return size() == 0; }
+
+        AllocatorType getAllocator() const { return allocator(); }
+
+        /**
+         * @brief Flattens the elements into a single vector copying each bucket in bulk.
+         * @return vector of the elements in the order of their indices
+         *
+         * @note this should not be called concurrently with appending,
+         * the elements whose construction has failed are skipped
+         */
+        Vector<Value, Allocator> toVector() const {
+            Vector<Value, Allocator> result(allocator());
+            result.reserve(size());
+            forEachConstructedRun([&result](Pointer const first, Pointer const last) { result.append(first, last); });
+
+            return result;
+        }
+    };
+
+    template<typename Value, typename Allocator>
+    constexpr size_t ConcurrentVector<Value, Allocator>::FIRST_BUCKET_SIZE_LOG;
+
+    template<typename Value, typename Allocator>
+    constexpr size_t ConcurrentVector<Value, Allocator>::FIRST_BUCKET_SIZE;
+
+    template<typename Value, typename Allocator>
+    constexpr size_t ConcurrentVector<Value, Allocator>::BUCKET_COUNT;
+} // namespace collection
+
+#endif //INCLUDE_CONCURRENT_VECTOR_H_
@@ -0,0 +1,603 @@
+#ifndef INCLUDE_FIXED_VECTOR_H_
+#define INCLUDE_FIXED_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <checks.h>
+#include <simd.h>
+
+namespace collection {
+
+    namespace detail {
+
+        /**
+         * @brief Smallest unsigned type able to hold the numbers up to the given one
+         */
+        template<size_t Maximum>
+        using FixedSizeType = typename std::conditional<
+                Maximum <= UINT8_MAX, std::uint8_t,
+                typename std::conditional<Maximum <= UINT16_MAX, std::uint16_t,
+                                          typename std::conditional<Maximum <= UINT32_MAX, std::uint32_t,
+                                                                    size_t>::type>::type>::type;
+
+        /**
+         * @brief Tag requesting the storage to be initialized so that it may be used in constant expressions
+         */
+        struct ConstantInitTag {
+            explicit constexpr ConstantInitTag() = default;
+        };
+
+        /**
+         * @brief Inline storage of up to {@code N} objects which does not construct the unused slots
+         * @tparam Value type of stored value
+         * @tparam N number of slots
+         *
+         * @note trivial objects are stored in a plain array so that they can be accessed in constant expressions
+         */
+        template<typename Value, size_t N, bool = std::is_trivial<Value>::value>
+        class FixedStorage {
+            Value values_[N];
+
+        protected:
+            FixedStorage() = default;
+
+            // constant expressions require all of the slots to be initialized
+            constexpr explicit FixedStorage(ConstantInitTag) noexcept : values_{} {}
+
+            constexpr Value* slots() noexcept { return values_; }
+
+            constexpr Value const* slots() const noexcept { return values_; }
+
+            template<typename... Arguments>
+            constexpr void constructAt(size_t const index, Arguments&&... arguments) {
+                values_[index] = Value(std::forward<Arguments>(arguments)...);
+            }
+
+            constexpr void destroyAt(size_t) noexcept {}
+        };
+
+        template<typename Value, size_t N>
+        class FixedStorage<Value, N, false> {
+            typename std::aligned_storage<sizeof(Value), alignof(Value)>::type slots_[N];
+
+        protected:
+            FixedStorage() = default;
+
+            explicit FixedStorage(ConstantInitTag) noexcept {}
+
+            Value* slots() noexcept { return reinterpret_cast<Value*>(slots_); }
+
+            Value const* slots() const noexcept { return reinterpret_cast<Value const*>(slots_); }
+
+            template<typename... Arguments>
+            void constructAt(size_t const index, Arguments&&... arguments) {
+                ::new (static_cast<void*>(slots() + index)) Value(std::forward<Arguments>(arguments)...);
+            }
+
+            void destroyAt(size_t const index) noexcept { slots()[index].~Value(); }
+        };
+
+        /**
+         * @brief Storage and size of {@link FixedVector} whose special members are trivial if {@code Value}'s are
+         * @tparam Value type of stored value
+         * @tparam N maximal number of elements
+         */
+        template<typename Value, size_t N, bool = std::is_trivially_copyable<Value>::value>
+        class FixedVectorBase : protected FixedStorage<Value, N> {
+            typedef FixedStorage<Value, N> Storage;
+
+        protected:
+            FixedSizeType<N> size_;
+
+            FixedVectorBase() noexcept : size_(0) {}
+
+            constexpr explicit FixedVectorBase(ConstantInitTag const tag) noexcept : Storage(tag), size_(0) {}
+        };
+
+        template<typename Value, size_t N>
+        class FixedVectorBase<Value, N, false> : protected FixedStorage<Value, N> {
+            typedef FixedStorage<Value, N> Storage;
+
+        protected:
+            using Storage::constructAt;
+            using Storage::destroyAt;
+            using Storage::slots;
+
+            FixedSizeType<N> size_;
+
+            FixedVectorBase() noexcept : size_(0) {}
+
+            explicit FixedVectorBase(ConstantInitTag const tag) noexcept : Storage(tag), size_(0) {}
+
+            void destroyFrom(size_t const newSize) noexcept {
+                while (size_ > newSize) destroyAt(--size_);
+            }
+
+            /**
+             * @brief Assigns the elements over the common prefix, constructs the rest and destroys the surplus
+             */
+            template<typename Source, typename Transfer>
+            void assignFrom(Source const source, size_t const sourceSize, Transfer transfer) {
+                auto const common = std::min(static_cast<size_t>(size_), sourceSize);
+                for (size_t i = 0; i < common; ++i) slots()[i] = transfer(source[i]);
+                for (; size_ < sourceSize; ++size_) constructAt(size_, transfer(source[size_]));
+                destroyFrom(sourceSize);
+            }
+
+        public:
+            FixedVectorBase(FixedVectorBase const& other) : Storage(), size_(0) {
+                auto const source = other.slots();
+                try {
+                    for (; size_ < other.size_; ++size_) constructAt(size_, source[size_]);
+                } catch (...) {
+                    destroyFrom(0);
+                    throw;
+                }
+            }
+
+            FixedVectorBase(FixedVectorBase&& other) noexcept(std::is_nothrow_move_constructible<Value>::value)
+                : Storage(), size_(0) {
+                auto const source = other.slots();
+                try {
+                    for (; size_ < other.size_; ++size_) constructAt(size_, std::move(source[size_]));
+                } catch (...) {
+                    destroyFrom(0);
+                    throw;
+                }
+            }
+
+            FixedVectorBase& operator=(FixedVectorBase const& other) {
+                if (this != &other) {
+                    assignFrom(other.slots(), other.size_, [](Value const& value) -> Value const& { return value; });
+                }
+
+                return *this;
+            }
+
+            FixedVectorBase& operator=(FixedVectorBase&& other) noexcept(
+                    std::is_nothrow_move_constructible<Value>::value && std::is_nothrow_move_assignable<Value>::value) {
+                if (this != &other) {
+                    assignFrom(other.slots(), other.size_, [](Value& value) -> Value&& { return std::move(value); });
+                }
+
+                return *this;
+            }
+
+            ~FixedVectorBase() { destroyFrom(0); }
+        };
+    } // namespace detail
+
+    /**
+     * @brief Vector of at most {@code N} elements stored inline so that it never allocates
+     *
+     * The unused slots are left unconstructed and the vector is trivially copyable if {@code Value} is.
+     * For trivial types the vector may be used in constant expressions if it is created by one of the filling
+     * constructors (e.g. from an initializer list which may be empty) as C++14 requires all of the storage
+     * to be initialized there.
+     *
+     * @tparam Value type of stored value
+     * @tparam N maximal number of elements
+     *
+     * @note {@link SmallVector} should be used if there may occasionally be more elements
+     */
+    template<typename Value, size_t N>
+    class FixedVector : protected detail::FixedVectorBase<Value, N> {
+        static_assert(N > 0, "FixedVector should have a positive capacity");
+
+        typedef detail::FixedVectorBase<Value, N> Base;
+
+    public:
+        typedef Value ValueType;
+        typedef Value value_type;
+        typedef Value& reference;
+        typedef Value const& ConstReference;
+        typedef Value&& RValueReference;
+        typedef Value* Pointer;
+        typedef Value const* ConstPointer;
+        typedef Pointer Iterator;
+        typedef ConstPointer ConstIterator;
+
+    protected:
+        using Base::size_;
+        using Base::constructAt;
+        using Base::destroyAt;
+        using Base::slots;
+
+        /* ************************************************* Checks ************************************************* */
+
+        constexpr void checkRange(size_t const index) const {
+            if (index >= size_) detail::throwOutOfRange(index, size_);
+        }
+
+        constexpr void checkNotEmpty() const {
+            if (size_ == 0) detail::throwOutOfRangeEmpty();
+        }
+
+        static constexpr void checkLength(size_t const requiredSize) {
+            if (requiredSize > N) detail::throwLengthError(requiredSize);
+        }
+
+        /**
+         * @brief Checks the index passed to the unchecked accessors if {@code COLLECTION_VECTOR_CHECKS} is at least 2
+         * @param index index of the accessed element
+         */
+        constexpr void checkAccess(size_t const index) const {
+#if COLLECTION_VECTOR_CHECKS >= 2
+            checkRange(index);
+#else
+            static_cast<void>(index);
+#endif
+        }
+
+        /**
+         * @brief Gets the position as an index checking that it lies within the elements or at their end
+         * if {@code COLLECTION_VECTOR_CHECKS} is at least 1
+         * @param position checked position
+         * @return index of the position
+         */
+        size_t checkedIndex(ConstIterator const position) const {
+#if COLLECTION_VECTOR_CHECKS >= 1
+            if (position < slots()) detail::throwRangeError("`position` is out of lower bound");
+            if (position > slots() + size_) detail::throwRangeError("`position` is out of higher bound");
+#endif
+
+            return static_cast<size_t>(position - slots());
+        }
+
+        /* ***************************************** Internal modification ****************************************** */
+
+        template<typename... Arguments>
+        constexpr reference uncheckedEmplaceBack(Arguments&&... arguments) {
+            constructAt(size_, std::forward<Arguments>(arguments)...);
+
+            return slots()[size_++];
+        }
+
+        void truncate(size_t const newSize) noexcept {
+            while (size_ > newSize) destroyAt(--size_);
+        }
+
+        /**
+         * @brief Moves the elements from the given index to the end of the range before it
+         * and destroys the surplus
+         * @param to index to which the element at {@code from} gets moved
+         * @param from index of the first kept element
+         */
+        void closeGap(size_t const to, size_t const from) {
+            auto const array = slots();
+            std::move(array + from, array + size_, array + to);
+            truncate(size_ - (from - to));
+        }
+
+    public:
+        /* ********************************************** Constructors ********************************************** */
+
+        FixedVector() noexcept = default;
+
+        /**
+         * @brief Creates a vector containing copies of the given values.
+         * @param values values which should be {@bold copied} into this vector
+         */
+        constexpr FixedVector(std::initializer_list<ValueType> const values) : Base(detail::ConstantInitTag{}) {
+            checkLength(values.size());
+            for (auto const& value : values) uncheckedEmplaceBack(value);
+        }
+
+        /**
+         * @brief Creates a vector of the given number of copies of the value.
+         * @param size size of the created vector
+         * @param value value which should be {@bold copied}
+         */
+        constexpr FixedVector(size_t const size, ConstReference value) : Base(detail::ConstantInitTag{}) {
+            checkLength(size);
+            for (size_t i = 0; i < size; ++i) uncheckedEmplaceBack(value);
+        }
+
+        /**
+         * @brief Creates a vector of the given number of value-initialized elements.
+         * @param size size of the created vector
+         */
+        constexpr explicit FixedVector(size_t const size) : Base(detail::ConstantInitTag{}) {
+            checkLength(size);
+            for (size_t i = 0; i < size; ++i) uncheckedEmplaceBack();
+        }
+
+        template<typename InputIterator,
+                 typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+        FixedVector(InputIterator const first, InputIterator const last) : FixedVector() {
+            append(first, last);
+        }
+
+        /* ********************************************* Indexed access ********************************************* */
+
+        constexpr reference operator[](size_t const index) {
+            checkAccess(index);
+
+            return slots()[index];
+        }
+
+        constexpr ConstReference operator[](size_t const index) const {
+            checkAccess(index);
+
+            return slots()[index];
+        }
+
+        constexpr reference at(size_t const index) {
+            checkRange(index);
+
+            return slots()[index];
+        }
+
+        constexpr ConstReference at(size_t const index) const {
+            checkRange(index);
+
+            return slots()[index];
+        }
+
+        /* ***************************************** Iterators and pointers ***************************************** */
+
+        constexpr Iterator begin() noexcept { return slots(); }
+
+        constexpr ConstIterator begin() const noexcept { return slots(); }
+
+        constexpr ConstIterator cbegin() const noexcept { return slots(); }
+
+        constexpr Iterator end() noexcept { return slots() + size_; }
+
+        constexpr ConstIterator end() const noexcept { return slots() + size_; }
+
+        constexpr ConstIterator cend() const noexcept { return slots() + size_; }
+
+        constexpr Iterator front() noexcept { return slots(); }
+
+        constexpr ConstIterator front() const noexcept { return slots(); }
+
+        constexpr Iterator back() noexcept { return size_ == 0 ? slots() : slots() + size_ - 1; }
+
+        constexpr ConstIterator back() const noexcept { return size_ == 0 ? slots() : slots() + size_ - 1; }
+
+        constexpr Pointer data() noexcept { return slots(); }
+
+        constexpr ConstPointer data() const noexcept { return slots(); }
+
+        /* ********************************************* Data accessors ********************************************* */
+
+        constexpr bool empty() const noexcept { return size_ == 0; }
+
+        constexpr bool full() const noexcept { return size_ == N; }
+
+        constexpr size_t size() const noexcept { return size_; }
+
+        static constexpr size_t capacity() noexcept { return N; }
+
+        static constexpr size_t maxSize() noexcept { return N; }
+
+        /* ************************************************* Search ************************************************* */
+
+        /**
+         * @brief Finds the first element equal to the value.
+         * @param value searched value
+         * @return iterator pointing to the found element or {@link #end()} if there is none
+         *
+         * @note integral elements are compared by vector instructions
+         */
+        Iterator find(ConstReference value) { return slots() + simd::find<ValueType>(slots(), size_, value); }
+
+        ConstIterator find(ConstReference value) const {
+            return slots() + simd::find<ValueType>(slots(), size_, value);
+        }
+
+        size_t count(ConstReference value) const { return simd::count<ValueType>(slots(), size_, value); }
+
+        bool contains(ConstReference value) const { return simd::find<ValueType>(slots(), size_, value) != size_; }
+
+        /* *********************************************** Modifiers ************************************************ */
+
+        /**
+         * @brief Appends a new element constructed from the arguments.
+         * @param arguments arguments forwarded to the element's constructor
+         * @return reference to the constructed element
+         *
+         * @throws std::length_error if the vector is full
+         */
+        template<typename... Arguments>
+        constexpr reference emplaceBack(Arguments&&... arguments) {
+            checkLength(static_cast<size_t>(size_) + 1);
+
+            return uncheckedEmplaceBack(std::forward<Arguments>(arguments)...);
+        }
+
+        constexpr void pushBack(ConstReference value) { emplaceBack(value); }
+
+        constexpr void pushBack(RValueReference value) { emplaceBack(std::forward<RValueReference>(value)); }
+
+        /**
+         * @brief Appends a new element constructed from the arguments unless the vector is full.
+         * @param arguments arguments forwarded to the element's constructor
+         * @return {@code true} if the element has been appended and {@code false} if the vector is full
+         */
+        template<typename... Arguments>
+        constexpr bool tryEmplaceBack(Arguments&&... arguments) {
+            if (size_ == N) return false;
+
+            uncheckedEmplaceBack(std::forward<Arguments>(arguments)...);
+
+            return true;
+        }
+
+        constexpr bool tryPushBack(ConstReference value) { return tryEmplaceBack(value); }
+
+        constexpr bool tryPushBack(RValueReference value) {
+            return tryEmplaceBack(std::forward<RValueReference>(value));
+        }
+
+        constexpr void popBack() {
+#if COLLECTION_VECTOR_CHECKS >= 1
+            checkNotEmpty();
+#endif
+
+            destroyAt(--size_);
+        }
+
+        void clear() noexcept { truncate(0); }
+
+        void resize(size_t const newSize) {
+            checkLength(newSize);
+            if (newSize < size_) truncate(newSize);
+            else while (size_ < newSize) uncheckedEmplaceBack();
+        }
+
+        void resize(size_t const newSize, ConstReference value) {
+            checkLength(newSize);
+            if (newSize < size_) truncate(newSize);
+            else while (size_ < newSize) uncheckedEmplaceBack(value);
+        }
+
+        /**
+         * @brief Appends copies of the elements of the range
+         * @param first iterator pointing to the first appended element, it should not point into this vector
+         * @param last iterator pointing after the last appended element
+         *
+         * @throws std::length_error if the elements do not fit in which case the vector is left unchanged
+         */
+        template<typename InputIterator,
+                 typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+        void append(InputIterator first, InputIterator const last) {
+            auto const oldSize = static_cast<size_t>(size_);
+            try {
+                for (; first != last; ++first) emplaceBack(*first);
+            } catch (...) {
+                truncate(oldSize);
+                throw;
+            }
+        }
+
+        /**
+         * @brief Appends copies of the elements of the range
+         * @param range range providing {@code begin()} and {@code end()}, it should not be this vector
+         */
+        template<typename Range>
+        void append(Range const& range) {
+            using std::begin;
+            using std::end;
+            append(begin(range), end(range));
+        }
+
+        /**
+         * @brief Constructs a new element in place before the given position
+         * @param position position before which the element should be constructed
+         * @param arguments arguments forwarded to the element's constructor, they may refer to this vector's elements
+         * @return reference to the constructed element
+         */
+        template<typename... Arguments>
+        reference emplace(ConstIterator const position, Arguments&&... arguments) {
+            auto const index = checkedIndex(position);
+            emplaceBack(std::forward<Arguments>(arguments)...);
+            auto const array = slots();
+            std::rotate(array + index, array + size_ - 1, array + size_);
+
+            return array[index];
+        }
+
+        void insert(ConstIterator const position, ConstReference value) { emplace(position, value); }
+
+        void insert(ConstIterator const position, RValueReference value) {
+            emplace(position, std::forward<RValueReference>(value));
+        }
+
+        void erase(ConstIterator const from, ConstIterator const to) {
+            auto const array = slots();
+#if COLLECTION_VECTOR_CHECKS >= 1
+            if (from > to) detail::throwLogicError("`from` cannot be after `to`");
+            if (from < array) detail::throwRangeError("`from` is out of lower bound");
+            if (to > array + size_) detail::throwRangeError("`to` is out of higher bound");
+#endif
+
+            if (from != to) closeGap(static_cast<size_t>(from - array), static_cast<size_t>(to - array));
+        }
+
+        void erase(ConstIterator const position) { erase(position, position + 1); }
+
+        /**
+         * @brief Erases the element in constant time by moving the last element into its place
+         * so that the order of the elements is not preserved
+         * @param position position of the erased element
+         * @return iterator pointing to the element which has taken the place of the erased one
+         * (which is {@link #end()} if the erased element was the last one)
+         */
+        Iterator swapErase(ConstIterator const position) {
+            auto const array = slots();
+#if COLLECTION_VECTOR_CHECKS >= 1
+            if (position < array) detail::throwRangeError("`position` is out of lower bound");
+            if (position >= array + size_) detail::throwRangeError("`position` is out of higher bound");
+#endif
+
+            auto const index = static_cast<size_t>(position - array);
+            auto const last = static_cast<size_t>(size_) - 1;
+            if (index != last) array[index] = std::move(array[last]);
+            destroyAt(--size_);
+
+            return array + index;
+        }
+
+        /**
+         * @brief Erases all elements satisfying the predicate in a single pass preserving the order of the rest
+         * @param predicate predicate called once for each element
+         * @return number of erased elements
+         */
+        template<typename Predicate>
+        size_t eraseIf(Predicate predicate) {
+            auto const array = slots();
+            auto const kept = std::remove_if(array, array + size_, [&predicate](ConstReference value) -> bool {
+                return predicate(value);
+            });
+            auto const erased = static_cast<size_t>(array + size_ - kept);
+            truncate(static_cast<size_t>(kept - array));
+
+            return erased;
+        }
+    };
+
+    /* ************************************************* Comparison ************************************************* */
+
+    template<typename Value, size_t N>
+    bool operator==(FixedVector<Value, N> const& left, FixedVector<Value, N> const& right) {
+        return left.size() == right.size() && simd::mismatch(left.data(), right.data(), left.size()) == left.size();
+    }
+
+    template<typename Value, size_t N>
+    bool operator!=(FixedVector<Value, N> const& left, FixedVector<Value, N> const& right) {
+        return !(left == right);
+    }
+
+    template<typename Value, size_t N>
+    bool operator<(FixedVector<Value, N> const& left, FixedVector<Value, N> const& right) {
+        return simd::compare(left.data(), left.size(), right.data(), right.size()) < 0;
+    }
+
+    template<typename Value, size_t N>
+    bool operator<=(FixedVector<Value, N> const& left, FixedVector<Value, N> const& right) {
+        return simd::compare(left.data(), left.size(), right.data(), right.size()) <= 0;
+    }
+
+    template<typename Value, size_t N>
+    bool operator>(FixedVector<Value, N> const& left, FixedVector<Value, N> const& right) {
+        return simd::compare(left.data(), left.size(), right.data(), right.size()) > 0;
+    }
+
+    template<typename Value, size_t N>
+    bool operator>=(FixedVector<Value, N> const& left, FixedVector<Value, N> const& right) {
+        return simd::compare(left.data(), left.size(), right.data(), right.size()) >= 0;
+    }
+} // namespace collection
+
+#endif //INCLUDE_FIXED_VECTOR_H_
@@ -0,0 +1,487 @@
+#ifndef INCLUDE_FLAT_MAP_H_
+#define INCLUDE_FLAT_MAP_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <checks.h>
+#include <flat_set.h>
+#include <index_iterator.h>
+#include <vector.h>
+#include <vector_ref.h>
+
+namespace collection {
+
+    /**
+     * @brief Map of unique keys to values keeping the keys sorted in one {@link Vector} and the values in another
+     * so that lookups binary-search a contiguous array of the keys only
+     *
+     * Similarly to {@link FlatSet} the map is suited for the lookup tables which are built once and read many times
+     * and {@link #insertBatch()} adds any number of entries by a single sort and merge.
+     *
+     * @tparam Key type of stored key
+     * @tparam Mapped type of stored value
+     * @tparam Compare comparator defining the strict weak order of the keys
+     * @tparam Allocator type of allocator which gets rebound for the keys and for the values
+     */
+    template<typename Key, typename Mapped, typename Compare = std::less<Key>,
+             typename Allocator = std::allocator<std::pair<Key, Mapped>>>
+    class FlatMap {
+    public:
+        typedef Key KeyType;
+        typedef Mapped MappedType;
+        typedef std::pair<Key, Mapped> ValueType;
+        typedef ValueType value_type;
+        typedef std::pair<Key const&, Mapped&> reference;
+        typedef std::pair<Key const&, Mapped const&> ConstReference;
+        typedef Compare CompareType;
+        typedef Allocator AllocatorType;
+        typedef Vector<Key, typename std::allocator_traits<Allocator>::template rebind_alloc<Key>> KeyVector;
+        typedef Vector<Mapped, typename std::allocator_traits<Allocator>::template rebind_alloc<Mapped>> ValueVector;
+        typedef Vector<ValueType, typename std::allocator_traits<Allocator>::template rebind_alloc<ValueType>>
+                EntryVector;
+
+        /**
+         * @brief Random access iterator over the entries yielding pairs of references to their keys and values
+         *
+         * @note the iterator is a proxy so the algorithms swapping the pointed values (e.g. sorting) do not work
+         */
+        typedef detail::IndexIterator<FlatMap, reference, void> Iterator;
+        typedef detail::IndexIterator<FlatMap const, ConstReference, void> ConstIterator;
+
+    protected:
+        /**
+         * @brief Keys sorted by the comparator without equivalent ones
+         */
+        KeyVector keys_;
+        /**
+         * @brief Values stored at the same indices as their keys
+         */
+        ValueVector values_;
+        Compare compare_;
+
+        /**
+         * @brief Comparator ordering the entries by their keys
+         */
+        struct EntryCompare {
+            Compare const& compare;
+
+            bool operator()(ValueType const& left, ValueType const& right) const {
+                return compare(left.first, right.first);
+            }
+        };
+
+        [[noreturn]] COLLECTION_COLD static void throwKeyNotFound() { throw std::out_of_range("Key not found"); }
+
+        template<typename, typename, typename>
+        friend class detail::IndexIterator;
+
+        reference elementAt(size_t const index) { return reference(keys_[index], values_[index]); }
+
+        ConstReference elementAt(size_t const index) const { return ConstReference(keys_[index], values_[index]); }
+
+        size_t lowerIndex(Key const& key) const {
+            return detail::branchlessLowerBound(keys_.data(), keys_.size(), key, compare_);
+        }
+
+        /**
+         * @brief Finds the index of the key equivalent to the given one
+         * @param key searched key
+         * @return index of the found key or the size if there is none
+         */
+        size_t indexOf(Key const& key) const {
+            auto const size = keys_.size();
+            auto const index = lowerIndex(key);
+
+            return index != size && !compare_(key, keys_[index]) ? index : size;
+        }
+
+        /**
+         * @brief Inserts the new entry at the given index removing its key back if the value cannot be constructed
+         * @param index index of the inserted entry which should keep the keys sorted
+         * @param key key of the entry
+         * @param arguments arguments forwarded to the constructor of the value
+         */
+        template<typename KeyArgument, typename... Arguments>
+        void emplaceAt(size_t const index, KeyArgument&& key, Arguments&&... arguments) {
+            keys_.emplace(keys_.begin() + index, std::forward<KeyArgument>(key));
+            try {
+                values_.emplace(values_.begin() + index, std::forward<Arguments>(arguments)...);
+            } catch (...) {
+                keys_.erase(keys_.begin() + index, keys_.begin() + index + 1);
+                throw;
+            }
+        }
+
+        /**
+         * @brief Appends the entry to the vectors of the keys and the values
+         * which should have the capacity for it
+         */
+        static void appendEntry(KeyVector& keys, ValueVector& values, Key&& key, Mapped&& value) {
+            keys.emplaceBack(std::move(key));
+            try {
+                values.emplaceBack(std::move(value));
+            } catch (...) {
+                keys.popBack();
+                throw;
+            }
+        }
+
+        /**
+         * @brief Sorts the entries and merges the ones with new keys into this map
+         * so that the earlier of the equivalent keys are kept
+         * @param entries entries which get moved into this map
+         *
+         * @note if a comparison or a move throws, the map gets cleared
+         */
+        void mergeEntries(EntryVector& entries) {
+            if (entries.empty()) return;
+
+            auto const first = entries.data();
+            try {
+                std::stable_sort(first, first + entries.size(), EntryCompare{compare_});
+                auto const entryCount = static_cast<size_t>(
+                        std::unique(first, first + entries.size(), detail::Equivalent<EntryCompare>{{compare_}})
+                        - first);
+                auto const size = keys_.size();
+
+                // appending keys greater than all of the present ones needs no merge
+                if (size == 0 || compare_(keys_[size - 1], first->first)) {
+                    keys_.reserve(size + entryCount);
+                    values_.reserve(size + entryCount);
+                    for (size_t i = 0; i < entryCount; ++i) {
+                        appendEntry(keys_, values_, std::move(first[i].first), std::move(first[i].second));
+                    }
+                    return;
+                }
+
+                KeyVector keys(keys_.getAllocator());
+                ValueVector values(values_.getAllocator());
+                keys.reserve(size + entryCount);
+                values.reserve(size + entryCount);
+                size_t present = 0, added = 0;
+                while (present < size && added < entryCount) {
+                    auto& entry = first[added];
+                    if (compare_(entry.first, keys_[present])) {
+                        appendEntry(keys, values, std::move(entry.first), std::move(entry.second));
+                        ++added;
+                    } else {
+                        if (!compare_(keys_[present], entry.first)) ++added;
+                        appendEntry(keys, values, std::move(keys_[present]), std::move(values_[present]));
+                        ++present;
+                    }
+                }
+                for (; present < size; ++present) {
+                    appendEntry(keys, values, std::move(keys_[present]), std::move(values_[present]));
+                }
+                for (; added < entryCount; ++added) {
+                    appendEntry(keys, values, std::move(first[added].first), std::move(first[added].second));
+                }
+                keys_.swap(keys);
+                values_.swap(values);
+            } catch (...) {
+                clear();
+                throw;
+            }
+        }
+
+    public:
+        /* ********************************************** Constructors ********************************************** */
+
+        FlatMap() = default;
+
+        /**
+         * @brief Creates a new empty map using the given comparator and allocator.
+         * @param compare comparator of the keys
+         * @param allocator allocator rebound for the keys and for the values
+         */
+        explicit FlatMap(Compare const& compare, AllocatorType const& allocator = AllocatorType())
+            : keys_(typename KeyVector::AllocatorType(allocator)),
+              values_(typename ValueVector::AllocatorType(allocator)), compare_(compare) {}
+
+        /**
+         * @brief Creates a map of the entries of the range sorting them at once.
+         * @param first iterator pointing to the first entry
+         * @param last iterator pointing after the last entry
+         * @param compare comparator of the keys
+         * @param allocator allocator rebound for the keys and for the values
+         *
+         * @note of the entries with equivalent keys the first one is kept
+         */
+        template<typename InputIterator,
+                 typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+        FlatMap(InputIterator const first, InputIterator const last, Compare const& compare = Compare(),
+                AllocatorType const& allocator = AllocatorType())
+            : FlatMap(compare, allocator) {
+            insertBatch(first, last);
+        }
+
+        FlatMap(std::initializer_list<ValueType> const entries, Compare const& compare = Compare(),
+                AllocatorType const& allocator = AllocatorType())
+            : FlatMap(entries.begin(), entries.end(), compare, allocator) {}
+
+        /**
+         * @brief Creates a map taking the entries of the vector which get sorted at once.
+         * @param entries vector whose entries should be {@bold moved} into this map
+         * @param compare comparator of the keys
+         *
+         * @note the storage for the keys and the values gets allocated once for all of the entries
+         */
+        explicit FlatMap(EntryVector&& entries, Compare const& compare = Compare())
+            : FlatMap(compare, entries.getAllocator()) {
+            mergeEntries(entries);
+            entries.clear();
+        }
+
+        /* ********************************************* Data accessors ********************************************* */
+
+        bool empty() const noexcept { return keys_.empty(); }
+
+        size_t size() const noexcept { return keys_.size(); }
+
+        size_t capacity() const noexcept { return std::min(keys_.capacity(), values_.capacity()); }
+
+        Compare const& compare() const noexcept { return compare_; }
+
+        /**
+         * @brief Gets the sorted keys as a contiguous array.
+         * @return view of the keys which is valid until the next modification
+         */
+        VectorView<Key> keys() const noexcept { return keys_; }
+
+        /**
+         * @brief Gets the values ordered by their keys as a contiguous array.
+         * @return view of the values which is valid until the next modification
+         */
+        MutableVectorView<Mapped> values() noexcept { return values_; }
+
+        VectorView<Mapped> values() const noexcept { return values_; }
+
+        /* ********************************************** Keyed access ********************************************** */
+
+        /**
+         * @brief Gets the value of the given key inserting a value-initialized one if there is none.
+         * @param key key of the value
+         * @return reference to the value
+         */
+        Mapped& operator[](Key const& key) { return values_[tryEmplace(key).first.index()]; }
+
+        Mapped& at(Key const& key) {
+            auto const index = indexOf(key);
+            if (index == keys_.size()) throwKeyNotFound();
+
+            return values_[index];
+        }
+
+        Mapped const& at(Key const& key) const {
+            auto const index = indexOf(key);
+            if (index == keys_.size()) throwKeyNotFound();
+
+            return values_[index];
+        }
+
+        /* *********************************************** Iterators ************************************************ */
+
+        Iterator begin() noexcept { return Iterator(this, 0); }
+
+        Iterator end() noexcept { return Iterator(this, size()); }
+
+        ConstIterator begin() const noexcept { return ConstIterator(this, 0); }
+
+        ConstIterator end() const noexcept { return ConstIterator(this, size()); }
+
+        ConstIterator cbegin() const noexcept { return begin(); }
+
+        ConstIterator cend() const noexcept { return end(); }
+
+        /* ************************************************* Search ************************************************* */
+
+        /**
+         * @brief Finds the first entry whose key is not less than the given one.
+         * @param key searched key
+         * @return iterator pointing to the found entry or {@link #end()} if there is none
+         */
+        Iterator lowerBound(Key const& key) { return Iterator(this, lowerIndex(key)); }
+
+        ConstIterator lowerBound(Key const& key) const { return ConstIterator(this, lowerIndex(key)); }
+
+        /**
+         * @brief Finds the first entry whose key is greater than the given one.
+         * @param key searched key
+         * @return iterator pointing to the found entry or {@link #end()} if there is none
+         */
+        Iterator upperBound(Key const& key) {
+            return Iterator(this, detail::branchlessUpperBound(keys_.data(), keys_.size(), key, compare_));
+        }
+
+        ConstIterator upperBound(Key const& key) const {
+            return ConstIterator(this, detail::branchlessUpperBound(keys_.data(), keys_.size(), key, compare_));
+        }
+
+        /**
+         * @brief Finds the entry whose key is equivalent to the given one.
+         * @param key searched key
+         * @return iterator pointing to the found entry or {@link #end()} if there is none
+         */
+        Iterator find(Key const& key) { return Iterator(this, indexOf(key)); }
+
+        ConstIterator find(Key const& key) const { return ConstIterator(this, indexOf(key)); }
+
+        bool contains(Key const& key) const { return indexOf(key) != keys_.size(); }
+
+        size_t count(Key const& key) const { return contains(key) ? 1 : 0; }
+
+        /* *********************************************** Modifiers ************************************************ */
+
+        void reserve(size_t const newCapacity) {
+            keys_.reserve(newCapacity);
+            values_.reserve(newCapacity);
+        }
+
+        void shrinkToFit() {
+            keys_.shrinkToFit();
+            values_.shrinkToFit();
+        }
+
+        void clear() noexcept {
+            keys_.clear();
+            values_.clear();
+        }
+
+        /**
+         * @brief Inserts the entry constructing its value from the arguments unless there is an equivalent key.
+         * @param key key of the entry
+         * @param arguments arguments forwarded to the constructor of the value if it gets inserted
+         * @return iterator pointing to the inserted or the already present entry
+         * and {@code true} if the entry has been inserted
+         */
+        template<typename... Arguments>
+        std::pair<Iterator, bool> tryEmplace(Key const& key, Arguments&&... arguments) {
+            auto const index = lowerIndex(key);
+            if (index != keys_.size() && !compare_(key, keys_[index])) return {Iterator(this, index), false};
+
+            emplaceAt(index, key, std::forward<Arguments>(arguments)...);
+
+            return {Iterator(this, index), true};
+        }
+
+        template<typename... Arguments>
+        std::pair<Iterator, bool> tryEmplace(Key&& key, Arguments&&... arguments) {
+            auto const index = lowerIndex(key);
+            if (index != keys_.size() && !compare_(key, keys_[index])) return {Iterator(this, index), false};
+
+            emplaceAt(index, std::move(key), std::forward<Arguments>(arguments)...);
+
+            return {Iterator(this, index), true};
+        }
+
+        std::pair<Iterator, bool> insert(ValueType const& entry) { return tryEmplace(entry.first, entry.second); }
+
+        std::pair<Iterator, bool> insert(ValueType&& entry) {
+            return tryEmplace(std::move(entry.first), std::move(entry.second));
+        }
+
+        /**
+         * @brief Inserts the entry or assigns the value of the present entry with an equivalent key.
+         * @param key key of the entry
+         * @param value value which gets inserted or assigned
+         * @return iterator pointing to the entry and {@code true} if the entry has been inserted
+         */
+        template<typename Value>
+        std::pair<Iterator, bool> insertOrAssign(Key const& key, Value&& value) {
+            auto const inserted = tryEmplace(key, std::forward<Value>(value));
+            if (!inserted.second) values_[inserted.first.index()] = std::forward<Value>(value);
+
+            return inserted;
+        }
+
+        /**
+         * @brief Inserts the entries of the range skipping the ones whose keys are equivalent to the present keys.
+         * @param first iterator pointing to the first entry
+         * @param last iterator pointing after the last entry
+         *
+         * @note the entries are collected, sorted and merged with the present ones at once
+         * so that inserting {@code m} entries into the map of {@code n} costs {@code O(m log m + n)}
+         * instead of {@code m} shifts of both arrays
+         */
+        template<typename InputIterator,
+                 typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+        void insertBatch(InputIterator const first, InputIterator const last) {
+            EntryVector entries(typename EntryVector::AllocatorType(keys_.getAllocator()));
+            entries.append(first, last);
+            mergeEntries(entries);
+        }
+
+        /**
+         * @brief Inserts the entries of the range skipping the ones whose keys are equivalent to the present keys.
+         * @param range range providing {@code begin()} and {@code end()}, it should not be this map
+         */
+        template<typename Range>
+        void insertBatch(Range const& range) {
+            using std::begin;
+            using std::end;
+            insertBatch(begin(range), end(range));
+        }
+
+        void insertBatch(std::initializer_list<ValueType> const entries) {
+            insertBatch(entries.begin(), entries.end());
+        }
+
+        /**
+         * @brief Erases the entry whose key is equivalent to the given one.
+         * @param key key of the erased entry
+         * @return number of erased entries
+         */
+        size_t erase(Key const& key) {
+            auto const index = indexOf(key);
+            if (index == keys_.size()) return 0;
+
+            erase(ConstIterator(this, index));
+
+            return 1;
+        }
+
+        /**
+         * @brief Erases the entry at the given position.
+         * @param position position of the erased entry
+         * @return iterator pointing to the entry following the erased one
+         */
+        Iterator erase(ConstIterator const position) {
+            auto const index = position.index();
+            values_.erase(values_.begin() + index, values_.begin() + index + 1);
+            keys_.erase(keys_.begin() + index, keys_.begin() + index + 1);
+
+            return Iterator(this, index);
+        }
+
+        void swap(FlatMap& other) {
+            using std::swap;
+            keys_.swap(other.keys_);
+            values_.swap(other.values_);
+            swap(compare_, other.compare_);
+        }
+    };
+
+    /* ************************************************* Comparison ************************************************* */
+
+    template<typename Key, typename Mapped, typename Compare, typename Allocator>
+    bool operator==(FlatMap<Key, Mapped, Compare, Allocator> const& left,
+                    FlatMap<Key, Mapped, Compare, Allocator> const& right) {
+        return left.keys() == right.keys() && left.values() == right.values();
+    }
+
+    template<typename Key, typename Mapped, typename Compare, typename Allocator>
+    bool operator!=(FlatMap<Key, Mapped, Compare, Allocator> const& left,
+                    FlatMap<Key, Mapped, Compare, Allocator> const& right) {
+        return !(left == right);
+    }
+} // namespace collection
+
+#endif //INCLUDE_FLAT_MAP_H_
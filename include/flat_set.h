@@ -0,0 +1,353 @@
+#ifndef INCLUDE_FLAT_SET_H_
+#define INCLUDE_FLAT_SET_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <vector.h>
+#include <vector_ref.h>
+
+namespace collection {
+
+    namespace detail {
+
+        /**
+         * @brief Finds the first of the sorted values which is not less than the key
+         * without branching on the results of the comparisons
+         * @param first first of the values sorted by the comparator
+         * @param count number of the values
+         * @param key searched key
+         * @param compare comparator of the values and the key
+         * @return index of the found value or {@code count} if all values are less than the key
+         *
+         * @note the range halves on every step independently of the comparison result which only selects
+         * the half by a conditional move so there are no mispredicted branches
+         */
+        template<typename Value, typename Key, typename Compare>
+        size_t branchlessLowerBound(Value const* const first, size_t count, Key const& key, Compare const& compare) {
+            auto base = first;
+            while (count > 1) {
+                auto const half = count / 2;
+                base = compare(base[half], key) ? base + half : base;
+                count -= half;
+            }
+
+            return static_cast<size_t>(base - first) + (count == 1 && compare(*base, key));
+        }
+
+        /**
+         * @brief Finds the first of the sorted values which is greater than the key
+         * without branching on the results of the comparisons
+         * @param first first of the values sorted by the comparator
+         * @param count number of the values
+         * @param key searched key
+         * @param compare comparator of the values and the key
+         * @return index of the found value or {@code count} if no value is greater than the key
+         */
+        template<typename Value, typename Key, typename Compare>
+        size_t branchlessUpperBound(Value const* const first, size_t count, Key const& key, Compare const& compare) {
+            auto base = first;
+            while (count > 1) {
+                auto const half = count / 2;
+                base = compare(key, base[half]) ? base : base + half;
+                count -= half;
+            }
+
+            return static_cast<size_t>(base - first) + (count == 1 && !compare(key, *base));
+        }
+
+        /**
+         * @brief Predicate telling whether the neighbouring values of a sorted range are equivalent
+         * @tparam Compare type of the comparator by which the range is sorted
+         */
+        template<typename Compare>
+        struct Equivalent {
+            Compare const& compare;
+
+            template<typename Value>
+            bool operator()(Value const& previous, Value const& next) const {
+                return !compare(previous, next);
+            }
+        };
+    } // namespace detail
+
+    /**
+     * @brief Set of unique keys stored sorted in a {@link Vector} so that lookups binary-search a contiguous array
+     *
+     * The set is suited for the lookup tables which are built once and read many times:
+     * single insertions and erasures shift the following keys while {@link #insertBatch()}
+     * adds any number of keys by a single sort and merge.
+     *
+     * @tparam Key type of stored key
+     * @tparam Compare comparator defining the strict weak order of the keys
+     * @tparam Allocator type of used allocator
+     */
+    template<typename Key, typename Compare = std::less<Key>, typename Allocator = std::allocator<Key>>
+    class FlatSet {
+    public:
+        typedef Key KeyType;
+        typedef Key ValueType;
+        typedef Key value_type;
+        typedef Key const& ConstReference;
+        typedef Compare CompareType;
+        typedef Allocator AllocatorType;
+        typedef Vector<Key, Allocator> VectorType;
+        typedef typename VectorType::ConstIterator ConstIterator;
+        typedef ConstIterator Iterator;
+
+    protected:
+        /**
+         * @brief Keys sorted by the comparator without equivalent ones
+         */
+        VectorType elements_;
+        Compare compare_;
+
+        ConstIterator iteratorAt(size_t const index) const { return elements_.begin() + index; }
+
+        size_t indexOf(ConstIterator const position) const { return static_cast<size_t>(position - elements_.begin()); }
+
+        /**
+         * @brief Sorts the keys appended after the given number of the sorted ones and merges them in
+         * removing the equivalent keys so that the earlier ones are kept
+         * @param sortedSize number of the first keys which are already sorted and unique
+         *
+         * @note if a comparison or a move throws, the set gets cleared
+         */
+        void mergeAppended(size_t const sortedSize) {
+            auto const size = elements_.size();
+            if (sortedSize == size) return;
+
+            auto const first = elements_.data(), middle = first + sortedSize, last = first + size;
+            try {
+                std::stable_sort(middle, last, compare_);
+                // appending keys greater than all of the present ones needs no merge
+                if (sortedSize != 0 && !compare_(middle[-1], *middle)) {
+                    std::inplace_merge(first, middle, last, compare_);
+                }
+                auto const uniqueEnd = std::unique(first, last, detail::Equivalent<Compare>{compare_});
+                elements_.erase(iteratorAt(static_cast<size_t>(uniqueEnd - first)), elements_.end());
+            } catch (...) {
+                elements_.clear();
+                throw;
+            }
+        }
+
+    public:
+        /* ********************************************** Constructors ********************************************** */
+
+        FlatSet() = default;
+
+        /**
+         * @brief Creates a new empty set using the given comparator and allocator.
+         * @param compare comparator of the keys
+         * @param allocator allocator used by the set
+         */
+        explicit FlatSet(Compare const& compare, AllocatorType const& allocator = AllocatorType())
+            : elements_(allocator), compare_(compare) {}
+
+        /**
+         * @brief Creates a set of the keys of the range sorting them at once.
+         * @param first iterator pointing to the first key
+         * @param last iterator pointing after the last key
+         * @param compare comparator of the keys
+         * @param allocator allocator used by the set
+         *
+         * @note forward ranges are allocated for at once
+         */
+        template<typename InputIterator,
+                 typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+        FlatSet(InputIterator const first, InputIterator const last, Compare const& compare = Compare(),
+                AllocatorType const& allocator = AllocatorType())
+            : elements_(allocator), compare_(compare) {
+            insertBatch(first, last);
+        }
+
+        FlatSet(std::initializer_list<Key> const keys, Compare const& compare = Compare(),
+                AllocatorType const& allocator = AllocatorType())
+            : FlatSet(keys.begin(), keys.end(), compare, allocator) {}
+
+        /**
+         * @brief Creates a set taking the keys of the vector which get sorted and deduplicated in place.
+         * @param keys vector whose keys should be {@bold moved} into this set
+         * @param compare comparator of the keys
+         */
+        explicit FlatSet(VectorType&& keys, Compare const& compare = Compare())
+            : elements_(std::move(keys)), compare_(compare) {
+            mergeAppended(0);
+        }
+
+        /* ********************************************* Data accessors ********************************************* */
+
+        bool empty() const noexcept { return elements_.empty(); }
+
+        size_t size() const noexcept { return elements_.size(); }
+
+        size_t capacity() const noexcept { return elements_.capacity(); }
+
+        Compare const& compare() const noexcept { return compare_; }
+
+        /**
+         * @brief Gets the sorted keys as a contiguous array.
+         * @return view of the keys which is valid until the next modification
+         */
+        VectorView<Key> keys() const noexcept { return elements_; }
+
+        /* *********************************************** Iterators ************************************************ */
+
+        ConstIterator begin() const { return elements_.begin(); }
+
+        ConstIterator end() const { return elements_.end(); }
+
+        ConstIterator cbegin() const { return elements_.begin(); }
+
+        ConstIterator cend() const { return elements_.end(); }
+
+        /* ************************************************* Search ************************************************* */
+
+        /**
+         * @brief Finds the first key which is not less than the given one.
+         * @param key searched key
+         * @return iterator pointing to the found key or {@link #end()} if there is none
+         */
+        ConstIterator lowerBound(Key const& key) const {
+            return iteratorAt(detail::branchlessLowerBound(elements_.data(), elements_.size(), key, compare_));
+        }
+
+        /**
+         * @brief Finds the first key which is greater than the given one.
+         * @param key searched key
+         * @return iterator pointing to the found key or {@link #end()} if there is none
+         */
+        ConstIterator upperBound(Key const& key) const {
+            return iteratorAt(detail::branchlessUpperBound(elements_.data(), elements_.size(), key, compare_));
+        }
+
+        /**
+         * @brief Finds the key equivalent to the given one.
+         * @param key searched key
+         * @return iterator pointing to the found key or {@link #end()} if there is none
+         */
+        ConstIterator find(Key const& key) const {
+            auto const size = elements_.size();
+            auto const index = detail::branchlessLowerBound(elements_.data(), size, key, compare_);
+
+            return iteratorAt(index != size && !compare_(key, elements_[index]) ? index : size);
+        }
+
+        bool contains(Key const& key) const { return find(key) != end(); }
+
+        size_t count(Key const& key) const { return contains(key) ? 1 : 0; }
+
+        /* *********************************************** Modifiers ************************************************ */
+
+        void reserve(size_t const newCapacity) { elements_.reserve(newCapacity); }
+
+        void shrinkToFit() { elements_.shrinkToFit(); }
+
+        void clear() { elements_.clear(); }
+
+        /**
+         * @brief Inserts the key unless there is an equivalent one.
+         * @param key inserted key
+         * @return iterator pointing to the inserted or the already present key
+         * and {@code true} if the key has been inserted
+         */
+        std::pair<ConstIterator, bool> insert(Key const& key) { return emplace(key); }
+
+        std::pair<ConstIterator, bool> insert(Key&& key) { return emplace(std::move(key)); }
+
+        template<typename... Arguments>
+        std::pair<ConstIterator, bool> emplace(Arguments&&... arguments) {
+            Key key(std::forward<Arguments>(arguments)...);
+            auto const size = elements_.size();
+            auto const index = detail::branchlessLowerBound(elements_.data(), size, key, compare_);
+            if (index != size && !compare_(key, elements_[index])) return {iteratorAt(index), false};
+
+            elements_.emplace(iteratorAt(index), std::move(key));
+
+            return {iteratorAt(index), true};
+        }
+
+        /**
+         * @brief Inserts the keys of the range skipping the ones equivalent to the present keys.
+         * @param first iterator pointing to the first key
+         * @param last iterator pointing after the last key
+         *
+         * @note the keys are appended, sorted and merged with the present ones at once
+         * so that inserting {@code m} keys into the set of {@code n} costs {@code O(m log m + n)}
+         * instead of {@code m} shifts of the whole array
+         */
+        template<typename InputIterator,
+                 typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+        void insertBatch(InputIterator const first, InputIterator const last) {
+            auto const sortedSize = elements_.size();
+            elements_.append(first, last);
+            mergeAppended(sortedSize);
+        }
+
+        /**
+         * @brief Inserts the keys of the range skipping the ones equivalent to the present keys.
+         * @param range range providing {@code begin()} and {@code end()}, it should not be this set
+         */
+        template<typename Range>
+        void insertBatch(Range const& range) {
+            using std::begin;
+            using std::end;
+            insertBatch(begin(range), end(range));
+        }
+
+        void insertBatch(std::initializer_list<Key> const keys) { insertBatch(keys.begin(), keys.end()); }
+
+        /**
+         * @brief Erases the key equivalent to the given one.
+         * @param key erased key
+         * @return number of erased keys
+         */
+        size_t erase(Key const& key) {
+            auto const position = find(key);
+            if (position == end()) return 0;
+
+            erase(position);
+
+            return 1;
+        }
+
+        /**
+         * @brief Erases the key at the given position.
+         * @param position position of the erased key
+         * @return iterator pointing to the key following the erased one
+         */
+        ConstIterator erase(ConstIterator const position) {
+            auto const index = indexOf(position);
+            elements_.erase(position, position + 1);
+
+            return iteratorAt(index);
+        }
+
+        void swap(FlatSet& other) {
+            using std::swap;
+            elements_.swap(other.elements_);
+            swap(compare_, other.compare_);
+        }
+    };
+
+    /* ************************************************* Comparison ************************************************* */
+
+    template<typename Key, typename Compare, typename Allocator>
+    bool operator==(FlatSet<Key, Compare, Allocator> const& left, FlatSet<Key, Compare, Allocator> const& right) {
+        return left.keys() == right.keys();
+    }
+
+    template<typename Key, typename Compare, typename Allocator>
+    bool operator!=(FlatSet<Key, Compare, Allocator> const& left, FlatSet<Key, Compare, Allocator> const& right) {
+        return !(left == right);
+    }
+} // namespace collection
+
+#endif //INCLUDE_FLAT_SET_H_
@@ -0,0 +1,192 @@
+#ifndef INCLUDE_GROWTH_POLICY_H_
+#define INCLUDE_GROWTH_POLICY_H_
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#if defined(COLLECTION_USE_JEMALLOC)
+#include <jemalloc/jemalloc.h>
+#endif
+
+namespace collection {
+
+    /*
+     * A growth policy is a type providing the following static functions:
+     *
+     * size_t grow(size_t capacity, size_t requiredSize, size_t elementSize)
+     *     capacity to which the array of the given capacity should grow to fit at least requiredSize elements
+     *
+     * size_t fit(size_t requiredSize, size_t elementSize)
+     *     capacity which should be allocated for the explicitly requested number of elements
+     *     (so that the allocation may be rounded up to the size which the allocator would use anyway)
+     *
+     * Both of them should not return less than requiredSize.
+     *
+     * Optionally it may also provide
+     *
+     * size_t shrink(size_t size, size_t capacity, size_t elementSize)
+     *     capacity to which the array should shrink after removal of elements (or capacity to keep it as is)
+     */
+
+    namespace detail {
+
+        template<typename Policy, typename = void>
+        struct HasShrink : std::false_type {};
+
+        template<typename Policy>
+        struct HasShrink<Policy, decltype(static_cast<void>(Policy::shrink(
+                                         std::declval<size_t>(), std::declval<size_t>(), std::declval<size_t>())))>
+            : std::true_type {};
+    } // namespace detail
+
+    /**
+     * @brief Uniform access to the optional members of the growth policy
+     * @tparam Policy type of the growth policy
+     */
+    template<typename Policy>
+    struct GrowthPolicyTraits {
+    private:
+        static constexpr size_t shrink(size_t const size, size_t const capacity, size_t const elementSize,
+                                       std::true_type) {
+            return Policy::shrink(size, capacity, elementSize);
+        }
+
+        static constexpr size_t shrink(size_t, size_t const capacity, size_t, std::false_type) noexcept {
+            return capacity;
+        }
+
+    public:
+        /**
+         * @brief Calculates the capacity to which the array should shrink after removal of elements
+         * @param size current size of the array
+         * @param capacity current capacity of the array
+         * @param elementSize size of an element in bytes
+         * @return new capacity which is equal to {@code capacity} if the array should not shrink
+         */
+        static constexpr size_t shrink(size_t const size, size_t const capacity, size_t const elementSize) {
+            return shrink(size, capacity, elementSize, detail::HasShrink<Policy>{});
+        }
+    };
+
+    /**
+     * @brief Growth policy increasing capacity by half but at least to 2 elements
+     */
+    struct DefaultGrowthPolicy {
+        static constexpr size_t grow(size_t const capacity, size_t const requiredSize, size_t) noexcept {
+            auto const increased = capacity < 2 ? 2 : capacity + (capacity >> 1u);
+
+            return increased < requiredSize ? requiredSize : increased;
+        }
+
+        static constexpr size_t fit(size_t const requiredSize, size_t) noexcept { return requiredSize; }
+    };
+
+    /**
+     * @brief Growth policy doubling capacity, suitable for append-only workloads
+     * @tparam InitialCapacity capacity of the first allocation
+     */
+    template<size_t InitialCapacity = 4>
+    struct DoublingGrowthPolicy {
+        static_assert(InitialCapacity > 0, "Initial capacity should be positive");
+
+        static constexpr size_t grow(size_t const capacity, size_t const requiredSize, size_t) noexcept {
+            auto const increased = capacity == 0 ? InitialCapacity : capacity << 1u;
+
+            return increased < requiredSize ? requiredSize : increased;
+        }
+
+        static constexpr size_t fit(size_t const requiredSize, size_t) noexcept { return requiredSize; }
+    };
+
+    /**
+     * @brief Growth policy increasing capacity by a fixed number of elements,
+     * suitable for memory-constrained environments
+     * @tparam Step number of elements by which the capacity grows
+     */
+    template<size_t Step>
+    struct FixedStepGrowthPolicy {
+        static_assert(Step > 0, "Step should be positive");
+
+        static constexpr size_t grow(size_t, size_t const requiredSize, size_t) noexcept {
+            return (requiredSize + Step - 1) / Step * Step;
+        }
+
+        static constexpr size_t fit(size_t const requiredSize, size_t) noexcept { return requiredSize; }
+    };
+
+    /**
+     * @brief Growth policy rounding allocations of the base policy which span at least one page up to whole pages
+     * @tparam Base policy whose capacities get rounded
+     * @tparam PageSize size of the page in bytes
+     */
+    template<typename Base = DefaultGrowthPolicy, size_t PageSize = 4096>
+    struct PageRoundingGrowthPolicy {
+        static_assert(PageSize != 0 && (PageSize & (PageSize - 1)) == 0, "Page size should be a power of two");
+
+        static constexpr size_t round(size_t const capacity, size_t const elementSize) noexcept {
+            auto const bytes = capacity * elementSize;
+
+            return bytes < PageSize ? capacity : ((bytes + PageSize - 1) & ~(PageSize - 1)) / elementSize;
+        }
+
+        static constexpr size_t grow(size_t const capacity, size_t const requiredSize,
+                                     size_t const elementSize) noexcept {
+            return round(Base::grow(capacity, requiredSize, elementSize), elementSize);
+        }
+
+        static constexpr size_t fit(size_t const requiredSize, size_t const elementSize) noexcept {
+            return round(Base::fit(requiredSize, elementSize), elementSize);
+        }
+    };
+
+    /**
+     * @brief Growth policy which additionally shrinks the array once the size falls below the given fraction
+     * of its capacity so that long-living vectors give the memory back
+     * @tparam Base policy used for growth
+     * @tparam Numerator numerator of the fraction
+     * @tparam Denominator denominator of the fraction
+     * @tparam MinCapacity minimal capacity below which the array never shrinks automatically
+     */
+    template<typename Base = DefaultGrowthPolicy, size_t Numerator = 1, size_t Denominator = 4,
+             size_t MinCapacity = 64>
+    struct AutoShrinkGrowthPolicy : Base {
+        static_assert(Numerator < Denominator, "Fraction should be less than one");
+
+        static constexpr size_t shrink(size_t const size, size_t const capacity, size_t const elementSize) {
+            // the array is left half-empty so that following insertions do not cause immediate growth
+            return capacity < MinCapacity || size * Denominator >= capacity * Numerator
+                           ? capacity
+                           : Base::fit(size << 1u, elementSize);
+        }
+    };
+
+#if defined(COLLECTION_USE_JEMALLOC)
+    /**
+     * @brief Growth policy rounding capacities of the base policy up to jemalloc's size classes
+     * @tparam Base policy whose capacities get rounded
+     *
+     * @note this is only available if {@code COLLECTION_USE_JEMALLOC} is defined
+     */
+    template<typename Base = DefaultGrowthPolicy>
+    struct JemallocGrowthPolicy {
+        static size_t round(size_t const capacity, size_t const elementSize) noexcept {
+            if (capacity == 0) return 0;
+
+            auto const bytes = nallocx(capacity * elementSize, 0);
+
+            return bytes == 0 ? capacity : bytes / elementSize;
+        }
+
+        static size_t grow(size_t const capacity, size_t const requiredSize, size_t const elementSize) noexcept {
+            return round(Base::grow(capacity, requiredSize, elementSize), elementSize);
+        }
+
+        static size_t fit(size_t const requiredSize, size_t const elementSize) noexcept {
+            return round(Base::fit(requiredSize, elementSize), elementSize);
+        }
+    };
+#endif
+} // namespace collection
+
+#endif //INCLUDE_GROWTH_POLICY_H_
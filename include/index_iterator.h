@@ -0,0 +1,132 @@
+#ifndef INCLUDE_INDEX_ITERATOR_H_
+#define INCLUDE_INDEX_ITERATOR_H_
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace collection {
+
+    namespace detail {
+
+        /**
+         * @brief Random access iterator addressing the elements of a container by their indices
+         * @tparam Owner type of the container, const-qualified for read-only iterators,
+         * providing {@code ValueType} and {@code elementAt(size_t)} which returns the reference to the element
+         * @tparam Reference type of the reference to the element which may be a proxy
+         * @tparam Pointer type of the pointer to the element or {@code void} if the references are proxies
+         *
+         * @note proxy references do not allow the algorithms swapping the pointed values (e.g. sorting) to work
+         */
+        template<typename Owner, typename Reference, typename Pointer>
+        class IndexIterator {
+            template<typename, typename, typename>
+            friend class IndexIterator;
+
+            Owner* owner_;
+            size_t index_;
+
+        public:
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef typename std::remove_const<Owner>::type::ValueType value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef Reference reference;
+            typedef Pointer pointer;
+
+            constexpr IndexIterator() noexcept : owner_(nullptr), index_(0) {}
+
+            constexpr IndexIterator(Owner* const owner, size_t const index) noexcept : owner_(owner), index_(index) {}
+
+            /**
+             * @brief Converts the mutable iterator to the read-only one
+             */
+            template<typename OtherOwner, typename OtherReference, typename OtherPointer,
+                     typename = typename std::enable_if<std::is_same<Owner, OtherOwner const>::value
+                                                        && !std::is_same<Owner, OtherOwner>::value>::type>
+            constexpr IndexIterator(IndexIterator<OtherOwner, OtherReference, OtherPointer> const& other) noexcept
+                : owner_(other.owner_), index_(other.index_) {}
+
+            /**
+             * @brief Gets the index of the pointed element.
+             */
+            constexpr size_t index() const noexcept { return index_; }
+
+            reference operator*() const { return owner_->elementAt(index_); }
+
+            template<typename Dereferenceable = Pointer,
+                     typename = typename std::enable_if<!std::is_void<Dereferenceable>::value>::type>
+            Dereferenceable operator->() const {
+                return std::addressof(owner_->elementAt(index_));
+            }
+
+            reference operator[](difference_type const offset) const { return owner_->elementAt(index_ + offset); }
+
+            IndexIterator& operator++() noexcept {
+                ++index_;
+                return *this;
+            }
+
+            IndexIterator operator++(int) noexcept { return IndexIterator(owner_, index_++); }
+
+            IndexIterator& operator--() noexcept {
+                --index_;
+                return *this;
+            }
+
+            IndexIterator operator--(int) noexcept { return IndexIterator(owner_, index_--); }
+
+            IndexIterator& operator+=(difference_type const offset) noexcept {
+                index_ += offset;
+                return *this;
+            }
+
+            IndexIterator& operator-=(difference_type const offset) noexcept {
+                index_ -= offset;
+                return *this;
+            }
+
+            friend IndexIterator operator+(IndexIterator iterator, difference_type const offset) noexcept {
+                return iterator += offset;
+            }
+
+            friend IndexIterator operator+(difference_type const offset, IndexIterator iterator) noexcept {
+                return iterator += offset;
+            }
+
+            friend IndexIterator operator-(IndexIterator iterator, difference_type const offset) noexcept {
+                return iterator -= offset;
+            }
+
+            friend difference_type operator-(IndexIterator const& left, IndexIterator const& right) noexcept {
+                return static_cast<difference_type>(left.index_) - static_cast<difference_type>(right.index_);
+            }
+
+            friend bool operator==(IndexIterator const& left, IndexIterator const& right) noexcept {
+                return left.index_ == right.index_;
+            }
+
+            friend bool operator!=(IndexIterator const& left, IndexIterator const& right) noexcept {
+                return left.index_ != right.index_;
+            }
+
+            friend bool operator<(IndexIterator const& left, IndexIterator const& right) noexcept {
+                return left.index_ < right.index_;
+            }
+
+            friend bool operator<=(IndexIterator const& left, IndexIterator const& right) noexcept {
+                return left.index_ <= right.index_;
+            }
+
+            friend bool operator>(IndexIterator const& left, IndexIterator const& right) noexcept {
+                return left.index_ > right.index_;
+            }
+
+            friend bool operator>=(IndexIterator const& left, IndexIterator const& right) noexcept {
+                return left.index_ >= right.index_;
+            }
+        };
+    } // namespace detail
+} // namespace collection
+
+#endif //INCLUDE_INDEX_ITERATOR_H_
@@ -0,0 +1,98 @@
+#ifndef INCLUDE_MALLOC_ALLOCATOR_H_
+#define INCLUDE_MALLOC_ALLOCATOR_H_
+
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace collection {
+
+    /**
+     * @brief Allocator backed by {@code malloc} family of functions supporting in-place and realloc-style growth
+     *
+     * @tparam Value type of allocated objects
+     *
+     * @note on glibc {@code realloc} of large (mmap-backed) blocks is performed via {@code mremap}
+     * so that the pages get remapped instead of being copied
+     */
+    template<typename Value>
+    class MallocAllocator {
+        static_assert(alignof(Value) <= alignof(std::max_align_t), "`malloc` cannot satisfy alignment of this type");
+
+        static size_t bytes(size_t const count) {
+            if (count > std::numeric_limits<size_t>::max() / sizeof(Value)) throw std::bad_alloc();
+
+            return count * sizeof(Value);
+        }
+
+    public:
+        typedef Value value_type;
+        typedef std::true_type is_always_equal;
+        typedef std::true_type propagate_on_container_move_assignment;
+
+        template<typename Other>
+        struct rebind {
+            typedef MallocAllocator<Other> other;
+        };
+
+        MallocAllocator() noexcept = default;
+
+        template<typename Other>
+        MallocAllocator(MallocAllocator<Other> const&) noexcept {}
+
+        Value* allocate(size_t const count) {
+            auto const pointer = std::malloc(bytes(count));
+            if (pointer == nullptr && count != 0) throw std::bad_alloc();
+
+            return static_cast<Value*>(pointer);
+        }
+
+        void deallocate(Value* const pointer, size_t) noexcept { std::free(pointer); }
+
+        /**
+         * @brief Attempts to extend the block without moving it
+         * by checking if the slack left by {@code malloc} is already enough
+         * @param pointer pointer to the allocated block
+         * @param newCapacity number of objects which should fit the block
+         * @return {@code true} if the block fits {@code newCapacity} objects and {@code false} otherwise
+         */
+        bool tryExpand(Value* const pointer, size_t, size_t const newCapacity) const noexcept {
+#if defined(__GLIBC__)
+            return pointer != nullptr && newCapacity <= malloc_usable_size(pointer) / sizeof(Value);
+#else
+            return false;
+#endif
+        }
+
+        /**
+         * @brief Resizes the block via {@code realloc}
+         * @param pointer pointer to the allocated block
+         * @param newCapacity number of objects which should fit the block
+         * @return pointer to the reallocated block
+         */
+        Value* reallocate(Value* const pointer, size_t, size_t const newCapacity) {
+            auto const reallocated = std::realloc(pointer, bytes(newCapacity));
+            if (reallocated == nullptr && newCapacity != 0) throw std::bad_alloc();
+
+            return static_cast<Value*>(reallocated);
+        }
+    };
+
+    template<typename Value, typename Other>
+    constexpr bool operator==(MallocAllocator<Value> const&, MallocAllocator<Other> const&) noexcept {
+        return true;
+    }
+
+    template<typename Value, typename Other>
+    constexpr bool operator!=(MallocAllocator<Value> const&, MallocAllocator<Other> const&) noexcept {
+        return false;
+    }
+} // namespace collection
+
+#endif //INCLUDE_MALLOC_ALLOCATOR_H_
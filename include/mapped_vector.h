@@ -0,0 +1,420 @@
+#ifndef INCLUDE_MAPPED_VECTOR_H_
+#define INCLUDE_MAPPED_VECTOR_H_
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <checks.h>
+#include <growth_policy.h>
+
+namespace collection {
+
+    /**
+     * @brief Vector of trivially copyable elements stored in a file mapped via {@code mmap}
+     * so that a previously filled vector gets opened in constant time and its pages get read lazily on first access
+     *
+     * The file starts with a small header holding the magic number, the element's size and alignment,
+     * the size and the capacity of the vector followed by the elements themselves.
+     * The file grows via {@code ftruncate} and gets remapped via {@code mremap} (where available)
+     * so that the elements never get copied.
+     *
+     * @tparam Value type of stored value
+     * @tparam GrowthPolicy policy deciding on the capacity of the file, it gets rounded up to whole pages
+     *
+     * @note the changes become visible to other processes mapping the same file immediately
+     * but they are only guaranteed to be durable after {@link #flush()};
+     * the file should not be opened by multiple vectors at once
+     */
+    template<typename Value, typename GrowthPolicy = DefaultGrowthPolicy>
+    class MappedVector {
+        static_assert(std::is_trivially_copyable<Value>::value, "Type should be trivially copyable");
+
+    public:
+        typedef Value ValueType;
+        typedef Value value_type;
+        typedef Value& reference;
+        typedef Value const& ConstReference;
+        typedef Value* Pointer;
+        typedef Value const* ConstPointer;
+        typedef Pointer Iterator;
+        typedef ConstPointer ConstIterator;
+        typedef GrowthPolicy GrowthPolicyType;
+
+        /**
+         * @brief Magic number identifying the files of mapped vectors, it reads as {@code "CLVECTOR"}
+         */
+        static constexpr std::uint64_t MAGIC = 0x524F544345564C43ull;
+
+        static constexpr std::uint32_t VERSION = 1;
+
+    protected:
+        /**
+         * @brief Header stored at the beginning of the file
+         */
+        struct Header {
+            std::uint64_t magic;
+            std::uint32_t version;
+            std::uint32_t elementSize;
+            std::uint32_t elementAlignment;
+            std::uint32_t reserved;
+            std::uint64_t size;
+            std::uint64_t capacity;
+        };
+
+        /**
+         * @brief Offset of the first element from the beginning of the file
+         */
+        static constexpr size_t DATA_OFFSET = alignof(Value) > 64 ? alignof(Value) : 64;
+
+        static_assert(sizeof(Header) <= DATA_OFFSET, "Header should fit before the elements");
+
+        int file_;
+        Header* header_;
+        size_t length_;
+
+        /* ************************************************* Checks ************************************************* */
+
+        [[noreturn]] COLLECTION_COLD static void throwSystemError(char const* const operation) {
+            throw std::system_error(errno, std::generic_category(), operation);
+        }
+
+        inline void checkRange(size_t const index) const {
+            if (index >= size()) detail::throwOutOfRange(index, size());
+        }
+
+        inline void checkNotEmpty() const {
+            if (empty()) detail::throwOutOfRangeEmpty();
+        }
+
+        static void checkLength(size_t const requiredSize) {
+            if (requiredSize > maxSize()) detail::throwLengthError(requiredSize);
+        }
+
+        /**
+         * @brief Checks that the header describes a vector of this type fitting the file
+         * @param length length of the file
+         */
+        void checkHeader(size_t const length) const {
+            if (header_->magic != MAGIC) throw std::runtime_error("File is not a mapped vector");
+            if (header_->version != VERSION) {
+                throw std::runtime_error("Unsupported mapped vector version " + std::to_string(header_->version));
+            }
+            if (header_->elementSize != sizeof(Value) || header_->elementAlignment != alignof(Value)) {
+                throw std::runtime_error("File holds elements of size " + std::to_string(header_->elementSize)
+                                         + " aligned at " + std::to_string(header_->elementAlignment) + " but "
+                                         + std::to_string(sizeof(Value)) + " aligned at "
+                                         + std::to_string(alignof(Value)) + " was expected");
+            }
+            if (header_->size > header_->capacity || header_->capacity > (length - DATA_OFFSET) / sizeof(Value)) {
+                throw std::runtime_error("Mapped vector's header does not match the file's length");
+            }
+        }
+
+        /* ************************************************* Mapping ************************************************ */
+
+        static size_t pageSize() noexcept {
+            static size_t const size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+            return size;
+        }
+
+        /**
+         * @brief Calculates the length of the file holding the given number of elements
+         * @param capacity number of elements
+         * @return number of bytes rounded up to whole pages
+         */
+        static size_t fileLength(size_t const capacity) noexcept {
+            auto const page = pageSize();
+
+            return (DATA_OFFSET + capacity * sizeof(Value) + page - 1) & ~(page - 1);
+        }
+
+        static size_t capacityOf(size_t const length) noexcept { return (length - DATA_OFFSET) / sizeof(Value); }
+
+        void truncateFile(size_t const length) {
+            if (ftruncate(file_, static_cast<off_t>(length)) != 0) throwSystemError("ftruncate");
+        }
+
+        void map(size_t const length) {
+            auto const address = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, file_, 0);
+            if (address == MAP_FAILED) throwSystemError("mmap");
+            header_ = static_cast<Header*>(address);
+            length_ = length;
+        }
+
+        /**
+         * @brief Changes the length of the file and of its mapping keeping the elements in place
+         * @param newLength new length of the file which is a multiple of the page size
+         */
+        void remap(size_t const newLength) {
+            auto const oldLength = length_;
+            if (newLength > oldLength) truncateFile(newLength);
+#if defined(__linux__)
+            auto const address = mremap(header_, oldLength, newLength, MREMAP_MAYMOVE);
+            if (address == MAP_FAILED) {
+                auto const error = errno;
+                if (newLength > oldLength) {
+                    // the file is shrunk back on a best-effort basis as the vector is intact anyway
+                    auto const truncated = ftruncate(file_, static_cast<off_t>(oldLength));
+                    static_cast<void>(truncated);
+                }
+                throw std::system_error(error, std::generic_category(), "mremap");
+            }
+            header_ = static_cast<Header*>(address);
+            length_ = newLength;
+#else
+            // the contents are kept by the file so it may simply be mapped anew
+            munmap(header_, oldLength);
+            header_ = nullptr;
+            map(newLength);
+#endif
+            if (newLength < oldLength) truncateFile(newLength);
+            header_->capacity = capacityOf(newLength);
+        }
+
+        void release() noexcept {
+            if (header_ != nullptr) munmap(header_, length_);
+            if (file_ >= 0) close(file_);
+            header_ = nullptr;
+            file_ = -1;
+            length_ = 0;
+        }
+
+        /**
+         * @brief Makes sure that the file can hold the given number of elements growing it by the policy
+         * @param requiredSize required number of elements
+         */
+        void ensureCapacity(size_t const requiredSize) {
+            auto const currentCapacity = capacity();
+            if (requiredSize > currentCapacity) {
+                checkLength(requiredSize);
+                remap(fileLength(std::min(GrowthPolicy::grow(currentCapacity, requiredSize, sizeof(Value)),
+                                          maxSize())));
+            }
+        }
+
+    public:
+        /* ********************************************** Constructors ********************************************** */
+
+        /**
+         * @brief Opens the vector stored in the file creating an empty one if the file does not exist or is empty.
+         * @param path path to the file
+         *
+         * @throws std::system_error if the file cannot be opened or mapped
+         * @throws std::runtime_error if the file does not hold a vector of this element type
+         * @note opening takes constant time as the elements get read only once they are accessed
+         */
+        explicit MappedVector(std::string const& path) : file_(-1), header_(nullptr), length_(0) {
+            file_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+            if (file_ < 0) throwSystemError("open");
+
+            try {
+                struct stat status;
+                if (fstat(file_, &status) != 0) throwSystemError("fstat");
+                auto const length = static_cast<size_t>(status.st_size);
+
+                if (length == 0) {
+                    auto const initialLength = fileLength(0);
+                    truncateFile(initialLength);
+                    map(initialLength);
+                    *header_ = Header{MAGIC, VERSION, sizeof(Value), alignof(Value), 0, 0, capacityOf(initialLength)};
+                } else {
+                    if (length < DATA_OFFSET) throw std::runtime_error("File is too short to be a mapped vector");
+                    map(length);
+                    checkHeader(length);
+                }
+            } catch (...) {
+                release();
+                throw;
+            }
+        }
+
+        MappedVector(MappedVector const&) = delete;
+
+        MappedVector& operator=(MappedVector const&) = delete;
+
+        /**
+         * @brief Takes over the mapping of the original vector.
+         * @param original vector which is left empty without any file, it may only be queried, assigned or destroyed
+         */
+        MappedVector(MappedVector&& original) noexcept
+            : file_(std::exchange(original.file_, -1)), header_(std::exchange(original.header_, nullptr)),
+              length_(std::exchange(original.length_, 0)) {}
+
+        MappedVector& operator=(MappedVector&& other) noexcept {
+            if (this != &other) {
+                release();
+                file_ = std::exchange(other.file_, -1);
+                header_ = std::exchange(other.header_, nullptr);
+                length_ = std::exchange(other.length_, 0);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Unmaps the file leaving the written elements to be written back by the system.
+         */
+        ~MappedVector() { release(); }
+
+        /* ********************************************* Indexed access ********************************************* */
+
+        reference operator[](size_t const index) { return data()[index]; }
+
+        ConstReference operator[](size_t const index) const { return data()[index]; }
+
+        reference at(size_t const index) {
+            checkRange(index);
+
+            return data()[index];
+        }
+
+        ConstReference at(size_t const index) const {
+            checkRange(index);
+
+            return data()[index];
+        }
+
+        /* ***************************************** Iterators and pointers ***************************************** */
+
+        // a moved-from vector has no mapping so it behaves as an empty vector without elements
+        Pointer data() noexcept {
+            return header_ == nullptr ? nullptr
+                                      : reinterpret_cast<Pointer>(reinterpret_cast<char*>(header_) + DATA_OFFSET);
+        }
+
+        ConstPointer data() const noexcept {
+            return header_ == nullptr
+                           ? nullptr
+                           : reinterpret_cast<ConstPointer>(reinterpret_cast<char const*>(header_) + DATA_OFFSET);
+        }
+
+        Iterator begin() noexcept { return data(); }
+
+        ConstIterator begin() const noexcept { return data(); }
+
+        ConstIterator cbegin() const noexcept { return data(); }
+
+        Iterator end() noexcept { return data() + size(); }
+
+        ConstIterator end() const noexcept { return data() + size(); }
+
+        ConstIterator cend() const noexcept { return data() + size(); }
+
+        /* ********************************************* Data accessors ********************************************* */
+
+        bool empty() const noexcept { return size() == 0; }
+
+        size_t size() const noexcept { return header_ == nullptr ? 0 : static_cast<size_t>(header_->size); }
+
+        size_t capacity() const noexcept { return header_ == nullptr ? 0 : static_cast<size_t>(header_->capacity); }
+
+        static constexpr size_t maxSize() noexcept {
+            return (static_cast<size_t>(std::numeric_limits<off_t>::max()) - DATA_OFFSET) / sizeof(Value);
+        }
+
+        /* *********************************************** Modifiers *********************************************** */
+
+        void reserve(size_t const newCapacity) {
+            if (capacity() < newCapacity) {
+                checkLength(newCapacity);
+                remap(fileLength(GrowthPolicy::fit(newCapacity, sizeof(Value))));
+            }
+        }
+
+        /**
+         * @brief Resizes this vector zero-filling the new elements.
+         * @param newSize new number of elements
+         */
+        void resize(size_t const newSize) {
+            auto const currentSize = size();
+            if (newSize > currentSize) {
+                ensureCapacity(newSize);
+                std::memset(static_cast<void*>(data() + currentSize), 0, (newSize - currentSize) * sizeof(Value));
+            }
+            header_->size = newSize;
+        }
+
+        void clear() noexcept {
+            if (header_ != nullptr) header_->size = 0;
+        }
+
+        void pushBack(ConstReference value) {
+            // the value may be an element of this vector which gets invalidated by the remapping
+            auto const copy = value;
+            ensureCapacity(size() + 1);
+            data()[size()] = copy;
+            ++header_->size;
+        }
+
+        void popBack() {
+            checkNotEmpty();
+
+            --header_->size;
+        }
+
+        /**
+         * @brief Appends the elements of the range copying them in bulk.
+         * @param first iterator pointing to the first appended element
+         * @param last iterator pointing after the last appended element
+         *
+         * @note the range should not refer to this vector's elements
+         */
+        template<typename ForwardIterator>
+        void append(ForwardIterator const first, ForwardIterator const last) {
+            auto const count = static_cast<size_t>(std::distance(first, last));
+            auto const currentSize = size();
+            if (count > maxSize() - currentSize) checkLength(maxSize() + 1);
+            ensureCapacity(currentSize + count);
+            std::copy(first, last, data() + currentSize);
+            header_->size = currentSize + count;
+        }
+
+        void append(std::initializer_list<ValueType> const values) { append(values.begin(), values.end()); }
+
+        /**
+         * @brief Shrinks the file to the smallest whole number of pages holding the elements.
+         */
+        void shrinkToFit() {
+            auto const newLength = fileLength(size());
+            if (newLength < length_) remap(newLength);
+        }
+
+        /**
+         * @brief Writes the elements and the header back to the file waiting for the write to complete.
+         *
+         * @throws std::system_error if the mapping cannot be written back
+         */
+        void flush() {
+            auto const length = std::min(length_, fileLength(size()));
+            if (msync(header_, length, MS_SYNC) != 0) throwSystemError("msync");
+        }
+    };
+
+    template<typename Value, typename GrowthPolicy>
+    constexpr std::uint64_t MappedVector<Value, GrowthPolicy>::MAGIC;
+
+    template<typename Value, typename GrowthPolicy>
+    constexpr std::uint32_t MappedVector<Value, GrowthPolicy>::VERSION;
+
+    template<typename Value, typename GrowthPolicy>
+    constexpr size_t MappedVector<Value, GrowthPolicy>::DATA_OFFSET;
+} // namespace collection
+
+#endif //INCLUDE_MAPPED_VECTOR_H_
@@ -0,0 +1,185 @@
+#ifndef INCLUDE_MMAP_ALLOCATOR_H_
+#define INCLUDE_MMAP_ALLOCATOR_H_
+
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace collection {
+
+    /**
+     * @brief Allocator mapping big blocks directly via {@code mmap} and delegating small ones to {@code std::allocator}
+     *
+     * Mapped blocks grow in place or get remapped without copying via {@code mremap} (where available)
+     * through the {@code tryExpand} and {@code reallocate} allocator extensions.
+     *
+     * @tparam Value type of allocated objects
+     * @tparam Threshold minimal size of the block (in bytes) which gets mapped
+     * @tparam HugePages whether mapped blocks should be backed by huge pages, either via {@code MAP_HUGETLB}
+     * if the system has reserved huge pages or by transparent huge pages via {@code madvise(MADV_HUGEPAGE)} otherwise
+     */
+    template<typename Value, size_t Threshold = (size_t{1} << 20u), bool HugePages = false>
+    class MmapAllocator : private std::allocator<Value> {
+        typedef std::allocator<Value> SmallAllocator;
+        typedef std::allocator_traits<SmallAllocator> SmallMemory;
+
+        static constexpr size_t HUGE_PAGE_SIZE = size_t{1} << 21u;
+
+        static size_t bytes(size_t const count) {
+            if (count > std::numeric_limits<size_t>::max() / sizeof(Value)) throw std::bad_alloc();
+
+            return count * sizeof(Value);
+        }
+
+        static bool isMapped(size_t const count) noexcept { return count * sizeof(Value) >= Threshold; }
+
+        static size_t pageSize() noexcept {
+            static size_t const size = HugePages ? HUGE_PAGE_SIZE : static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+            return size;
+        }
+
+        /**
+         * @brief Calculates the length of the mapping holding the given number of objects
+         * @param count number of objects
+         * @return number of bytes rounded up to whole pages
+         */
+        static size_t mappingLength(size_t const count) {
+            auto const page = pageSize();
+
+            return (bytes(count) + page - 1) & ~(page - 1);
+        }
+
+        static void adviseHugePages(void* const address, size_t const length) noexcept {
+#if defined(MADV_HUGEPAGE)
+            if (HugePages) madvise(address, length, MADV_HUGEPAGE);
+#else
+            static_cast<void>(address);
+            static_cast<void>(length);
+#endif
+        }
+
+        static void* map(size_t const length) {
+#if defined(MAP_HUGETLB)
+            if (HugePages) {
+                auto const address = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                if (address != MAP_FAILED) return address;
+                // no huge pages are reserved so transparent huge pages get requested
+            }
+#endif
+            auto const address = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (address == MAP_FAILED) throw std::bad_alloc();
+            adviseHugePages(address, length);
+
+            return address;
+        }
+
+    public:
+        typedef Value value_type;
+        typedef std::true_type is_always_equal;
+        typedef std::true_type propagate_on_container_move_assignment;
+
+        template<typename Other>
+        struct rebind {
+            typedef MmapAllocator<Other, Threshold, HugePages> other;
+        };
+
+        MmapAllocator() noexcept = default;
+
+        template<typename Other>
+        MmapAllocator(MmapAllocator<Other, Threshold, HugePages> const&) noexcept {}
+
+        Value* allocate(size_t const count) {
+            if (!isMapped(count)) return SmallMemory::allocate(*this, count);
+
+            return static_cast<Value*>(map(mappingLength(count)));
+        }
+
+        void deallocate(Value* const pointer, size_t const count) noexcept {
+            if (isMapped(count)) munmap(pointer, mappingLength(count));
+            else SmallMemory::deallocate(*this, pointer, count);
+        }
+
+        /**
+         * @brief Attempts to extend the mapped block without moving it
+         * @param pointer pointer to the allocated block
+         * @param oldCapacity number of objects for which the block was allocated
+         * @param newCapacity number of objects which should fit the block
+         * @return {@code true} if the block fits {@code newCapacity} objects and {@code false} otherwise
+         */
+        bool tryExpand(Value* const pointer, size_t const oldCapacity, size_t const newCapacity) {
+            if (!isMapped(oldCapacity)) return false;
+
+            auto const oldLength = mappingLength(oldCapacity), newLength = mappingLength(newCapacity);
+            // the rounding to the whole pages may have left enough space
+            if (newLength <= oldLength) return true;
+#if defined(__linux__)
+            if (mremap(pointer, oldLength, newLength, 0) == MAP_FAILED) return false;
+            adviseHugePages(pointer, newLength);
+
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        /**
+         * @brief Resizes the block moving its contents bytewise, mapped blocks get remapped without copying
+         * @param pointer pointer to the allocated block
+         * @param oldCapacity number of objects for which the block was allocated
+         * @param newCapacity number of objects which should fit the block
+         * @return pointer to the reallocated block
+         */
+        Value* reallocate(Value* const pointer, size_t const oldCapacity, size_t const newCapacity) {
+#if defined(__linux__)
+            if (isMapped(oldCapacity) && isMapped(newCapacity)) {
+                auto const newLength = mappingLength(newCapacity);
+                auto const address = mremap(pointer, mappingLength(oldCapacity), newLength, MREMAP_MAYMOVE);
+                if (address != MAP_FAILED) {
+                    adviseHugePages(address, newLength);
+
+                    return static_cast<Value*>(address);
+                }
+            }
+#endif
+            auto const newPointer = allocate(newCapacity);
+            std::memcpy(static_cast<void*>(newPointer), static_cast<void const*>(pointer),
+                        bytes(oldCapacity < newCapacity ? oldCapacity : newCapacity));
+            deallocate(pointer, oldCapacity);
+
+            return newPointer;
+        }
+    };
+
+    template<typename Value, size_t Threshold, bool HugePages>
+    constexpr size_t MmapAllocator<Value, Threshold, HugePages>::HUGE_PAGE_SIZE;
+
+    template<typename Value, typename Other, size_t Threshold, bool HugePages>
+    constexpr bool operator==(MmapAllocator<Value, Threshold, HugePages> const&,
+                              MmapAllocator<Other, Threshold, HugePages> const&) noexcept {
+        return true;
+    }
+
+    template<typename Value, typename Other, size_t Threshold, bool HugePages>
+    constexpr bool operator!=(MmapAllocator<Value, Threshold, HugePages> const&,
+                              MmapAllocator<Other, Threshold, HugePages> const&) noexcept {
+        return false;
+    }
+
+    /**
+     * @brief Allocator backing big blocks by huge pages to reduce TLB misses on scans of huge vectors
+     * @tparam Value type of allocated objects
+     * @tparam Threshold minimal size of the block (in bytes) which gets backed by huge pages
+     */
+    template<typename Value, size_t Threshold = (size_t{1} << 21u)>
+    using HugePageAllocator = MmapAllocator<Value, Threshold, true>;
+} // namespace collection
+
+#endif //INCLUDE_MMAP_ALLOCATOR_H_
@@ -0,0 +1,113 @@
+#ifndef INCLUDE_PARALLEL_H_
+#define INCLUDE_PARALLEL_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace collection {
+
+    /**
+     * @brief Tag type for overloads splitting the work over the elements across multiple threads
+     */
+    struct ParallelTag {
+        explicit constexpr ParallelTag() = default;
+    };
+
+    constexpr ParallelTag par{};
+
+    namespace parallel {
+
+        /**
+         * @brief Minimal number of elements processed by a single thread,
+         * smaller ranges are processed by the calling thread only
+         */
+        constexpr size_t MIN_CHUNK_SIZE = size_t{1} << 16u;
+
+        /**
+         * @brief Calculates the number of chunks (and thus threads) used to process the given number of elements
+         * @param count number of processed elements
+         * @return number of chunks which is {@code 1} if the range is too small to be worth splitting
+         */
+        inline size_t chunkCount(size_t const count) noexcept {
+            static size_t const threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+            return std::max(std::min(threads, count / MIN_CHUNK_SIZE), size_t{1});
+        }
+
+        /**
+         * @brief Performs the operation over each of the chunks of the range as a whole
+         * so that either all or none of the chunks get processed
+         *
+         * @param count number of elements in the range
+         * @param operation operation called with the first index and the size of the chunk
+         * which should either process all elements of the chunk or throw leaving the chunk untouched
+         * @param rollback operation called with the first index and the size of each processed chunk
+         * if any of the chunks has failed, it should not throw
+         *
+         * @note the chunks are processed by separate threads (the first one by the calling thread)
+         * so that the pages get touched by the threads which process them;
+         * if any of the operations has thrown, the first exception gets rethrown after the rollback
+         */
+        template<typename Operation, typename Rollback>
+        void forEachChunk(size_t const count, Operation operation, Rollback rollback) {
+            auto const chunks = chunkCount(count);
+            if (chunks == 1) {
+                operation(size_t{0}, count);
+                return;
+            }
+
+            auto const chunkSize = (count + chunks - 1) / chunks;
+            std::unique_ptr<std::exception_ptr[]> const errors(new (std::nothrow) std::exception_ptr[chunks]);
+            if (errors == nullptr) {
+                operation(size_t{0}, count);
+                return;
+            }
+            auto const process = [&](size_t const chunk) noexcept {
+                auto const first = chunk * chunkSize;
+                try {
+                    operation(first, std::min(chunkSize, count - first));
+                } catch (...) {
+                    errors[chunk] = std::current_exception();
+                }
+            };
+
+            std::vector<std::thread> workers;
+            try {
+                workers.reserve(chunks - 1);
+                for (size_t chunk = 1; chunk < chunks; ++chunk) workers.emplace_back(process, chunk);
+            } catch (...) {
+                // the chunks without a thread get processed by the calling thread
+                for (auto chunk = workers.size() + 1; chunk < chunks; ++chunk) process(chunk);
+            }
+            process(0);
+            for (auto& worker : workers) worker.join();
+
+            std::exception_ptr error;
+            for (size_t chunk = 0; chunk < chunks && error == nullptr; ++chunk) error = errors[chunk];
+            if (error == nullptr) return;
+
+            for (size_t chunk = 0; chunk < chunks; ++chunk) {
+                auto const first = chunk * chunkSize;
+                if (errors[chunk] == nullptr) rollback(first, std::min(chunkSize, count - first));
+            }
+            std::rethrow_exception(error);
+        }
+
+        /**
+         * @brief Performs the non-throwing operation over each of the chunks of the range
+         * @param count number of elements in the range
+         * @param operation operation called with the first index and the size of the chunk
+         */
+        template<typename Operation>
+        void forEachChunk(size_t const count, Operation operation) noexcept {
+            forEachChunk(count, operation, [](size_t, size_t) noexcept {});
+        }
+    } // namespace parallel
+} // namespace collection
+
+#endif //INCLUDE_PARALLEL_H_
@@ -0,0 +1,43 @@
+#ifndef INCLUDE_POLYMORPHIC_VECTOR_H_
+#define INCLUDE_POLYMORPHIC_VECTOR_H_
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <growth_policy.h>
+#include <vector.h>
+
+namespace collection {
+
+    /**
+     * @brief Vector with a {@code virtual} destructor allowing safe extension and deletion through a base pointer
+     *
+     * @tparam Value type of stored value
+     * @tparam Allocator type of used allocator
+     * @tparam GrowthPolicy policy deciding on the capacity of the allocated arrays
+     *
+     * @note this costs a vtable pointer per object, so {@link Vector} should be preferred unless polymorphism is needed
+     */
+    template<typename Value, typename Allocator = std::allocator<Value>, typename GrowthPolicy = DefaultGrowthPolicy>
+    class PolymorphicVector : public Vector<Value, Allocator, GrowthPolicy> {
+        typedef Vector<Value, Allocator, GrowthPolicy> Base;
+
+    public:
+        using Base::Base;
+
+        PolymorphicVector() = default;
+
+        PolymorphicVector(PolymorphicVector const&) = default;
+
+        PolymorphicVector(PolymorphicVector&&) = default;
+
+        PolymorphicVector& operator=(PolymorphicVector const&) = default;
+
+        PolymorphicVector& operator=(PolymorphicVector&&) = default;
+
+        virtual ~PolymorphicVector() = default;
+    };
+} // namespace collection
+
+#endif //INCLUDE_POLYMORPHIC_VECTOR_H_
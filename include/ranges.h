@@ -0,0 +1,779 @@
+#ifndef INCLUDE_RANGES_H_
+#define INCLUDE_RANGES_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <vector.h>
+#include <vector_ref.h>
+
+namespace collection {
+
+    /**
+     * @brief Lazy adapters over the ranges of elements which are fused into a single pass once collected
+     *
+     * The adapters are applied by the pipe operator, e.g.
+     * {@code values | ranges::filter(isValid) | ranges::map(normalize) | ranges::collectInto(output)}
+     * so that no intermediate vector is created. Containers are referenced by the adapters and should outlive them
+     * while the adapters and {@link VectorRef}s are held by value.
+     */
+    namespace ranges {
+
+        namespace detail {
+
+            /**
+             * @brief Base of the ranges which are cheap to copy and thus get held by value
+             */
+            struct ViewTag {};
+
+            /**
+             * @brief Base of the objects applied to ranges by the pipe operator
+             */
+            struct ClosureTag {};
+
+            template<typename Range>
+            struct IsViewType : std::is_base_of<ViewTag, Range> {};
+
+            template<typename Value>
+            struct IsViewType<VectorRef<Value>> : std::true_type {};
+
+            template<typename Range>
+            using IsView = IsViewType<typename std::decay<Range>::type>;
+
+            template<typename Iterator>
+            using Category = typename std::iterator_traits<Iterator>::iterator_category;
+
+            template<typename Iterator>
+            using IsRandomAccess = std::is_base_of<std::random_access_iterator_tag, Category<Iterator>>;
+
+            /**
+             * @brief Category of an iterator which may only go forward over the elements of the given iterator
+             */
+            template<typename Iterator>
+            using ForwardCategory = typename std::conditional<std::is_base_of<std::forward_iterator_tag,
+                                                                              Category<Iterator>>::value,
+                                                              std::forward_iterator_tag,
+                                                              std::input_iterator_tag>::type;
+
+            /**
+             * @brief Weakest of the categories of the given iterators
+             */
+            template<typename Left, typename Right>
+            using CommonCategory = typename std::conditional<std::is_base_of<Category<Left>, Category<Right>>::value,
+                                                             Category<Left>, Category<Right>>::type;
+        } // namespace detail
+
+        /* ************************************************ Sources ************************************************* */
+
+        /**
+         * @brief Range of the elements between two iterators
+         * @tparam Iterator type of the iterators
+         */
+        template<typename Iterator>
+        class IteratorRange : public detail::ViewTag {
+            Iterator begin_, end_;
+
+        public:
+            typedef Iterator IteratorType;
+
+            IteratorRange(Iterator const begin, Iterator const end) : begin_(begin), end_(end) {}
+
+            Iterator begin() const { return begin_; }
+
+            Iterator end() const { return end_; }
+
+            bool empty() const { return begin_ == end_; }
+
+            size_t size() const { return static_cast<size_t>(std::distance(begin_, end_)); }
+        };
+
+        /**
+         * @brief Gets the view of the range which may be held by the adapters.
+         * @param range view or adapter which gets copied
+         * @return copy of the range
+         */
+        template<typename Range, typename = typename std::enable_if<detail::IsView<Range>::value>::type>
+        typename std::decay<Range>::type all(Range&& range) {
+            return std::forward<Range>(range);
+        }
+
+        /**
+         * @brief Gets the view of the container which may be held by the adapters.
+         * @param container container providing {@code begin()} and {@code end()} which should outlive the view
+         * @return range of the container's elements
+         */
+        template<typename Container, typename = typename std::enable_if<!detail::IsView<Container>::value>::type>
+        IteratorRange<decltype(std::begin(std::declval<Container&>()))> all(Container& container) {
+            using std::begin;
+            using std::end;
+
+            return {begin(container), end(container)};
+        }
+
+        /**
+         * @brief Type of the view of the given range as held by the adapters
+         */
+        template<typename Range>
+        using ViewOf = decltype(all(std::declval<Range>()));
+
+        template<typename Range>
+        using IteratorOf = decltype(std::declval<ViewOf<Range> const&>().begin());
+
+        /**
+         * @brief Object applied to a range by the pipe operator
+         * @tparam Derived type of the closure providing {@code operator()} taking the range
+         */
+        template<typename Derived>
+        struct Closure : detail::ClosureTag {
+            template<typename Range>
+            friend auto operator|(Range&& range, Derived const& closure)
+                    -> decltype(closure(std::forward<Range>(range))) {
+                return closure(std::forward<Range>(range));
+            }
+        };
+
+        /* ************************************************** Map *************************************************** */
+
+        template<typename BaseIterator, typename Function>
+        class MapIterator {
+            BaseIterator current_;
+            Function const* function_;
+
+        public:
+            typedef detail::Category<BaseIterator> iterator_category;
+            typedef decltype(std::declval<Function const&>()(*std::declval<BaseIterator>())) reference;
+            typedef typename std::decay<reference>::type value_type;
+            typedef typename std::iterator_traits<BaseIterator>::difference_type difference_type;
+            typedef void pointer;
+
+            MapIterator() : current_(), function_(nullptr) {}
+
+            MapIterator(BaseIterator const current, Function const* const function)
+                : current_(current), function_(function) {}
+
+            reference operator*() const { return (*function_)(*current_); }
+
+            reference operator[](difference_type const offset) const { return (*function_)(current_[offset]); }
+
+            MapIterator& operator++() {
+                ++current_;
+                return *this;
+            }
+
+            MapIterator operator++(int) { return MapIterator(current_++, function_); }
+
+            MapIterator& operator--() {
+                --current_;
+                return *this;
+            }
+
+            MapIterator operator--(int) { return MapIterator(current_--, function_); }
+
+            MapIterator& operator+=(difference_type const offset) {
+                current_ += offset;
+                return *this;
+            }
+
+            MapIterator& operator-=(difference_type const offset) {
+                current_ -= offset;
+                return *this;
+            }
+
+            friend MapIterator operator+(MapIterator iterator, difference_type const offset) {
+                return iterator += offset;
+            }
+
+            friend MapIterator operator-(MapIterator iterator, difference_type const offset) {
+                return iterator -= offset;
+            }
+
+            friend difference_type operator-(MapIterator const& left, MapIterator const& right) {
+                return left.current_ - right.current_;
+            }
+
+            friend bool operator==(MapIterator const& left, MapIterator const& right) {
+                return left.current_ == right.current_;
+            }
+
+            friend bool operator!=(MapIterator const& left, MapIterator const& right) { return !(left == right); }
+
+            friend bool operator<(MapIterator const& left, MapIterator const& right) {
+                return left.current_ < right.current_;
+            }
+        };
+
+        /**
+         * @brief Range of the results of the function applied to each element of the base range
+         * @tparam Base type of the view of the base range
+         * @tparam Function type of the function called with each element
+         */
+        template<typename Base, typename Function>
+        class MapRange : public detail::ViewTag {
+            Base base_;
+            Function function_;
+
+        public:
+            typedef MapIterator<decltype(std::declval<Base const&>().begin()), Function> IteratorType;
+
+            MapRange(Base base, Function function) : base_(std::move(base)), function_(std::move(function)) {}
+
+            IteratorType begin() const { return IteratorType(base_.begin(), &function_); }
+
+            IteratorType end() const { return IteratorType(base_.end(), &function_); }
+        };
+
+        template<typename Function>
+        struct MapClosure : Closure<MapClosure<Function>> {
+            Function function;
+
+            explicit MapClosure(Function function) : function(std::move(function)) {}
+
+            template<typename Range>
+            MapRange<ViewOf<Range>, Function> operator()(Range&& range) const {
+                return {all(std::forward<Range>(range)), function};
+            }
+        };
+
+        /**
+         * @brief Creates the adapter transforming each element by the function.
+         * @param function function called with each element once per its dereference
+         */
+        template<typename Function>
+        MapClosure<typename std::decay<Function>::type> map(Function&& function) {
+            return MapClosure<typename std::decay<Function>::type>(std::forward<Function>(function));
+        }
+
+        /* ************************************************* Filter ************************************************* */
+
+        template<typename BaseIterator, typename Predicate>
+        class FilterIterator {
+            BaseIterator current_, end_;
+            Predicate const* predicate_;
+
+            void skipRejected() {
+                while (current_ != end_ && !(*predicate_)(*current_)) ++current_;
+            }
+
+        public:
+            typedef detail::ForwardCategory<BaseIterator> iterator_category;
+            typedef typename std::iterator_traits<BaseIterator>::reference reference;
+            typedef typename std::iterator_traits<BaseIterator>::value_type value_type;
+            typedef typename std::iterator_traits<BaseIterator>::difference_type difference_type;
+            typedef typename std::iterator_traits<BaseIterator>::pointer pointer;
+
+            FilterIterator() : current_(), end_(), predicate_(nullptr) {}
+
+            FilterIterator(BaseIterator const current, BaseIterator const end, Predicate const* const predicate)
+                : current_(current), end_(end), predicate_(predicate) {
+                skipRejected();
+            }
+
+            reference operator*() const { return *current_; }
+
+            FilterIterator& operator++() {
+                ++current_;
+                skipRejected();
+
+                return *this;
+            }
+
+            FilterIterator operator++(int) {
+                auto const previous = *this;
+                ++*this;
+
+                return previous;
+            }
+
+            friend bool operator==(FilterIterator const& left, FilterIterator const& right) {
+                return left.current_ == right.current_;
+            }
+
+            friend bool operator!=(FilterIterator const& left, FilterIterator const& right) { return !(left == right); }
+        };
+
+        /**
+         * @brief Range of the elements of the base range satisfying the predicate
+         * @tparam Base type of the view of the base range
+         * @tparam Predicate type of the predicate called with each element
+         */
+        template<typename Base, typename Predicate>
+        class FilterRange : public detail::ViewTag {
+            Base base_;
+            Predicate predicate_;
+
+        public:
+            typedef FilterIterator<decltype(std::declval<Base const&>().begin()), Predicate> IteratorType;
+
+            FilterRange(Base base, Predicate predicate) : base_(std::move(base)), predicate_(std::move(predicate)) {}
+
+            IteratorType begin() const { return IteratorType(base_.begin(), base_.end(), &predicate_); }
+
+            IteratorType end() const { return IteratorType(base_.end(), base_.end(), &predicate_); }
+        };
+
+        template<typename Predicate>
+        struct FilterClosure : Closure<FilterClosure<Predicate>> {
+            Predicate predicate;
+
+            explicit FilterClosure(Predicate predicate) : predicate(std::move(predicate)) {}
+
+            template<typename Range>
+            FilterRange<ViewOf<Range>, Predicate> operator()(Range&& range) const {
+                return {all(std::forward<Range>(range)), predicate};
+            }
+        };
+
+        /**
+         * @brief Creates the adapter skipping the elements which do not satisfy the predicate.
+         * @param predicate predicate called with the elements
+         */
+        template<typename Predicate>
+        FilterClosure<typename std::decay<Predicate>::type> filter(Predicate&& predicate) {
+            return FilterClosure<typename std::decay<Predicate>::type>(std::forward<Predicate>(predicate));
+        }
+
+        /* ************************************************** Take ************************************************** */
+
+        template<typename BaseIterator>
+        class TakeIterator {
+            BaseIterator current_, end_;
+            size_t remaining_;
+
+            bool finished() const { return remaining_ == 0 || current_ == end_; }
+
+        public:
+            typedef detail::ForwardCategory<BaseIterator> iterator_category;
+            typedef typename std::iterator_traits<BaseIterator>::reference reference;
+            typedef typename std::iterator_traits<BaseIterator>::value_type value_type;
+            typedef typename std::iterator_traits<BaseIterator>::difference_type difference_type;
+            typedef typename std::iterator_traits<BaseIterator>::pointer pointer;
+
+            TakeIterator() : current_(), end_(), remaining_(0) {}
+
+            TakeIterator(BaseIterator const current, BaseIterator const end, size_t const remaining)
+                : current_(current), end_(end), remaining_(remaining) {}
+
+            reference operator*() const { return *current_; }
+
+            TakeIterator& operator++() {
+                ++current_;
+                --remaining_;
+
+                return *this;
+            }
+
+            TakeIterator operator++(int) {
+                auto const previous = *this;
+                ++*this;
+
+                return previous;
+            }
+
+            friend bool operator==(TakeIterator const& left, TakeIterator const& right) {
+                auto const finished = left.finished();
+
+                return finished == right.finished() && (finished || left.current_ == right.current_);
+            }
+
+            friend bool operator!=(TakeIterator const& left, TakeIterator const& right) { return !(left == right); }
+        };
+
+        /**
+         * @brief Range of at most the given number of the first elements of the base range
+         * @tparam Base type of the view of the base range
+         *
+         * @note random access ranges are simply cut so that they stay random access
+         */
+        template<typename Base, bool = detail::IsRandomAccess<decltype(std::declval<Base const&>().begin())>::value>
+        class TakeRange : public detail::ViewTag {
+            Base base_;
+            size_t count_;
+
+        public:
+            typedef decltype(std::declval<Base const&>().begin()) IteratorType;
+
+            TakeRange(Base base, size_t const count) : base_(std::move(base)), count_(count) {}
+
+            IteratorType begin() const { return base_.begin(); }
+
+            IteratorType end() const {
+                auto const begin = base_.begin();
+                auto const size = static_cast<size_t>(base_.end() - begin);
+
+                return begin + static_cast<typename std::iterator_traits<IteratorType>::difference_type>(
+                                       std::min(size, count_));
+            }
+        };
+
+        template<typename Base>
+        class TakeRange<Base, false> : public detail::ViewTag {
+            Base base_;
+            size_t count_;
+
+        public:
+            typedef TakeIterator<decltype(std::declval<Base const&>().begin())> IteratorType;
+
+            TakeRange(Base base, size_t const count) : base_(std::move(base)), count_(count) {}
+
+            IteratorType begin() const { return IteratorType(base_.begin(), base_.end(), count_); }
+
+            IteratorType end() const { return IteratorType(base_.end(), base_.end(), 0); }
+        };
+
+        struct TakeClosure : Closure<TakeClosure> {
+            size_t count;
+
+            explicit TakeClosure(size_t const count) : count(count) {}
+
+            template<typename Range>
+            TakeRange<ViewOf<Range>> operator()(Range&& range) const {
+                return {all(std::forward<Range>(range)), count};
+            }
+        };
+
+        /**
+         * @brief Creates the adapter limiting the range to its first elements.
+         * @param count maximal number of the elements
+         */
+        inline TakeClosure take(size_t const count) { return TakeClosure(count); }
+
+        /* ************************************************** Zip *************************************************** */
+
+        template<typename LeftIterator, typename RightIterator>
+        class ZipIterator {
+            LeftIterator left_;
+            RightIterator right_;
+
+        public:
+            typedef detail::CommonCategory<LeftIterator, RightIterator> iterator_category;
+            typedef std::pair<typename std::iterator_traits<LeftIterator>::reference,
+                              typename std::iterator_traits<RightIterator>::reference>
+                    reference;
+            typedef std::pair<typename std::iterator_traits<LeftIterator>::value_type,
+                              typename std::iterator_traits<RightIterator>::value_type>
+                    value_type;
+            typedef typename std::iterator_traits<LeftIterator>::difference_type difference_type;
+            typedef void pointer;
+
+            ZipIterator() : left_(), right_() {}
+
+            ZipIterator(LeftIterator const left, RightIterator const right) : left_(left), right_(right) {}
+
+            reference operator*() const { return reference(*left_, *right_); }
+
+            reference operator[](difference_type const offset) const {
+                return reference(left_[offset], right_[offset]);
+            }
+
+            ZipIterator& operator++() {
+                ++left_;
+                ++right_;
+
+                return *this;
+            }
+
+            ZipIterator operator++(int) {
+                auto const previous = *this;
+                ++*this;
+
+                return previous;
+            }
+
+            ZipIterator& operator--() {
+                --left_;
+                --right_;
+
+                return *this;
+            }
+
+            ZipIterator operator--(int) {
+                auto const previous = *this;
+                --*this;
+
+                return previous;
+            }
+
+            ZipIterator& operator+=(difference_type const offset) {
+                left_ += offset;
+                right_ += offset;
+
+                return *this;
+            }
+
+            ZipIterator& operator-=(difference_type const offset) { return *this += -offset; }
+
+            friend ZipIterator operator+(ZipIterator iterator, difference_type const offset) {
+                return iterator += offset;
+            }
+
+            friend ZipIterator operator-(ZipIterator iterator, difference_type const offset) {
+                return iterator -= offset;
+            }
+
+            friend difference_type operator-(ZipIterator const& left, ZipIterator const& right) {
+                return left.left_ - right.left_;
+            }
+
+            /**
+             * @brief Tells whether the iterators are equal which is the case once any of their parts are
+             * so that the iteration stops at the end of the shorter range
+             */
+            friend bool operator==(ZipIterator const& left, ZipIterator const& right) {
+                return left.left_ == right.left_ || left.right_ == right.right_;
+            }
+
+            friend bool operator!=(ZipIterator const& left, ZipIterator const& right) { return !(left == right); }
+
+            friend bool operator<(ZipIterator const& left, ZipIterator const& right) {
+                return left.left_ < right.left_;
+            }
+        };
+
+        /**
+         * @brief Range of the pairs of the elements at the same positions of two ranges
+         * which is as long as the shorter of them
+         * @tparam Left type of the view of the range providing the first elements of the pairs
+         * @tparam Right type of the view of the range providing the second elements of the pairs
+         */
+        template<typename Left, typename Right>
+        class ZipRange : public detail::ViewTag {
+            typedef decltype(std::declval<Left const&>().begin()) LeftIterator;
+            typedef decltype(std::declval<Right const&>().begin()) RightIterator;
+
+        public:
+            typedef ZipIterator<LeftIterator, RightIterator> IteratorType;
+
+        private:
+            Left left_;
+            Right right_;
+
+            IteratorType end(std::true_type /* random access */) const {
+                auto const leftBegin = left_.begin();
+                auto const rightBegin = right_.begin();
+                auto const size = std::min(left_.end() - leftBegin, static_cast<decltype(left_.end() - leftBegin)>(
+                                                                            right_.end() - rightBegin));
+
+                return IteratorType(leftBegin + size, rightBegin + size);
+            }
+
+            IteratorType end(std::false_type /* random access */) const {
+                return IteratorType(left_.end(), right_.end());
+            }
+
+        public:
+            ZipRange(Left left, Right right) : left_(std::move(left)), right_(std::move(right)) {}
+
+            IteratorType begin() const { return IteratorType(left_.begin(), right_.begin()); }
+
+            IteratorType end() const { return end(detail::IsRandomAccess<IteratorType>{}); }
+        };
+
+        /**
+         * @brief Creates the range of the pairs of the elements at the same positions of two ranges.
+         * @param left range providing the first elements of the pairs
+         * @param right range providing the second elements of the pairs
+         * @return range as long as the shorter of the ranges
+         */
+        template<typename Left, typename Right>
+        ZipRange<ViewOf<Left>, ViewOf<Right>> zip(Left&& left, Right&& right) {
+            return {all(std::forward<Left>(left)), all(std::forward<Right>(right))};
+        }
+
+        /* ************************************************* Chunk ************************************************** */
+
+        namespace detail {
+
+            template<typename Value>
+            VectorRef<Value> makeChunk(Value* const first, Value* const last) {
+                return VectorRef<Value>(first, static_cast<size_t>(last - first));
+            }
+
+            template<typename Iterator>
+            IteratorRange<Iterator> makeChunk(Iterator const first, Iterator const last) {
+                return IteratorRange<Iterator>(first, last);
+            }
+
+            template<typename Iterator>
+            Iterator advanceWithin(Iterator const current, Iterator const end, size_t const count, std::true_type) {
+                auto const remaining = static_cast<size_t>(end - current);
+
+                return current + static_cast<typename std::iterator_traits<Iterator>::difference_type>(
+                                         std::min(count, remaining));
+            }
+
+            template<typename Iterator>
+            Iterator advanceWithin(Iterator current, Iterator const end, size_t count, std::false_type) {
+                for (; count != 0 && current != end; --count) ++current;
+
+                return current;
+            }
+        } // namespace detail
+
+        template<typename BaseIterator>
+        class ChunkIterator {
+            BaseIterator current_, end_;
+            size_t size_;
+
+            BaseIterator next() const {
+                return detail::advanceWithin(current_, end_, size_, detail::IsRandomAccess<BaseIterator>{});
+            }
+
+        public:
+            typedef detail::ForwardCategory<BaseIterator> iterator_category;
+            typedef decltype(detail::makeChunk(std::declval<BaseIterator>(), std::declval<BaseIterator>())) value_type;
+            typedef value_type reference;
+            typedef typename std::iterator_traits<BaseIterator>::difference_type difference_type;
+            typedef void pointer;
+
+            ChunkIterator() : current_(), end_(), size_(0) {}
+
+            ChunkIterator(BaseIterator const current, BaseIterator const end, size_t const size)
+                : current_(current), end_(end), size_(size) {}
+
+            reference operator*() const { return detail::makeChunk(current_, next()); }
+
+            ChunkIterator& operator++() {
+                current_ = next();
+                return *this;
+            }
+
+            ChunkIterator operator++(int) {
+                auto const previous = *this;
+                ++*this;
+
+                return previous;
+            }
+
+            friend bool operator==(ChunkIterator const& left, ChunkIterator const& right) {
+                return left.current_ == right.current_;
+            }
+
+            friend bool operator!=(ChunkIterator const& left, ChunkIterator const& right) { return !(left == right); }
+        };
+
+        /**
+         * @brief Range of the consecutive parts of the given size of the base range, the last part may be shorter
+         * @tparam Base type of the view of the base range
+         *
+         * @note the parts of contiguous ranges are {@link VectorRef}s
+         */
+        template<typename Base>
+        class ChunkRange : public detail::ViewTag {
+            Base base_;
+            size_t size_;
+
+        public:
+            typedef ChunkIterator<decltype(std::declval<Base const&>().begin())> IteratorType;
+
+            ChunkRange(Base base, size_t const size) : base_(std::move(base)), size_(size) {}
+
+            IteratorType begin() const { return IteratorType(base_.begin(), base_.end(), size_); }
+
+            IteratorType end() const { return IteratorType(base_.end(), base_.end(), size_); }
+        };
+
+        struct ChunkClosure : Closure<ChunkClosure> {
+            size_t size;
+
+            explicit ChunkClosure(size_t const size) : size(size) {
+                if (size == 0) throw std::invalid_argument("Chunk size should be positive");
+            }
+
+            template<typename Range>
+            ChunkRange<ViewOf<Range>> operator()(Range&& range) const {
+                return {all(std::forward<Range>(range)), size};
+            }
+        };
+
+        /**
+         * @brief Creates the adapter splitting the range into consecutive parts.
+         * @param size number of the elements in each part but the last one, should be positive
+         */
+        inline ChunkClosure chunk(size_t const size) { return ChunkClosure(size); }
+
+        /* ************************************************ Collect ************************************************* */
+
+        namespace detail {
+
+            template<typename Target, typename Iterator>
+            void appendAll(Target& target, Iterator const first, Iterator const last, std::true_type) {
+                // the number of the elements is known upfront so the target grows at most once
+                target.append(first, last);
+            }
+
+            template<typename Target, typename Iterator>
+            void appendAll(Target& target, Iterator first, Iterator const last, std::false_type) {
+                for (; first != last; ++first) target.emplaceBack(*first);
+            }
+
+            template<typename Target, typename Range>
+            void appendRange(Target& target, Range const& range) {
+                typedef decltype(range.begin()) Iterator;
+                appendAll(target, range.begin(), range.end(), IsRandomAccess<Iterator>{});
+            }
+        } // namespace detail
+
+        /**
+         * @brief Type of the vector collecting the range if no other type is requested
+         */
+        template<typename Range>
+        using DefaultTarget = Vector<typename std::iterator_traits<IteratorOf<Range>>::value_type>;
+
+        template<typename Target>
+        struct CollectClosure : Closure<CollectClosure<Target>> {
+            template<typename Range>
+            typename std::conditional<std::is_void<Target>::value, DefaultTarget<Range>, Target>::type
+            operator()(Range&& range) const {
+                typename std::conditional<std::is_void<Target>::value, DefaultTarget<Range>, Target>::type target;
+                detail::appendRange(target, all(std::forward<Range>(range)));
+
+                return target;
+            }
+        };
+
+        /**
+         * @brief Creates the terminal collecting the elements of the range into a new vector.
+         * @tparam Target type of the vector providing {@code append()} and {@code emplaceBack()},
+         * {@link DefaultTarget} is used if it is {@code void}
+         *
+         * @note random access ranges are allocated for at once, other ones are appended element by element
+         */
+        template<typename Target = void>
+        CollectClosure<Target> collect() {
+            return {};
+        }
+
+        template<typename Target>
+        struct CollectIntoClosure : Closure<CollectIntoClosure<Target>> {
+            Target& target;
+
+            explicit CollectIntoClosure(Target& target) : target(target) {}
+
+            template<typename Range>
+            Target& operator()(Range&& range) const {
+                target.clear();
+                detail::appendRange(target, all(std::forward<Range>(range)));
+
+                return target;
+            }
+        };
+
+        /**
+         * @brief Creates the terminal replacing the elements of the existing vector by the ones of the range.
+         * @param target vector providing {@code clear()}, {@code append()} and {@code emplaceBack()}
+         * whose capacity gets reused, it should not be referenced by the range
+         *
+         * @note the terminal returns the reference to the target
+         */
+        template<typename Target>
+        CollectIntoClosure<Target> collectInto(Target& target) {
+            return CollectIntoClosure<Target>(target);
+        }
+    } // namespace ranges
+} // namespace collection
+
+#endif //INCLUDE_RANGES_H_
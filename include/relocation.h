@@ -0,0 +1,352 @@
+#ifndef INCLUDE_RELOCATION_H_
+#define INCLUDE_RELOCATION_H_
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace collection {
+
+    /**
+     * @brief Trait telling whether objects of the given type can be relocated (moved to a new address and destroyed
+     * at the old one) by a plain byte copy
+     *
+     * @tparam Type type whose objects are relocated
+     *
+     * @note this is {@code true} for all trivially copyable types and may be specialized by users for types which
+     * are not trivially copyable but do not depend on their own address (e.g. types owning a heap pointer)
+     */
+    template<typename Type>
+    struct is_trivially_relocatable : std::is_trivially_copyable<Type> {};
+
+    /**
+     * @brief Way in which objects get relocated by containers
+     */
+    enum class RelocationKind {
+        /** objects are copied bytewise */
+        BITWISE,
+        /** objects are moved by their non-throwing move constructor */
+        NOTHROW_MOVE,
+        /** objects are copied so that the originals are left intact if any of the copies fails */
+        COPY,
+        /** objects are moved by their throwing move constructor as they cannot be copied,
+         * if it throws the originals are left in their moved-from states */
+        THROWING_MOVE
+    };
+
+    /**
+     * @brief Trait telling how the objects of the given type get relocated
+     * similarly to {@code std::move_if_noexcept}
+     * @tparam Type type whose objects are relocated
+     */
+    template<typename Type>
+    struct relocation_kind
+        : std::integral_constant<RelocationKind,
+                                 is_trivially_relocatable<Type>::value               ? RelocationKind::BITWISE
+                                 : std::is_nothrow_move_constructible<Type>::value ? RelocationKind::NOTHROW_MOVE
+                                 : std::is_copy_constructible<Type>::value         ? RelocationKind::COPY
+                                                                                   : RelocationKind::THROWING_MOVE> {
+    };
+
+    namespace relocation {
+
+        /**
+         * @brief Tag used to dispatch relocation algorithms
+         * @tparam Type type whose objects are relocated
+         */
+        template<typename Type>
+        using Bitwise = std::integral_constant<bool, is_trivially_relocatable<Type>::value>;
+
+        /**
+         * @brief Tag used to dispatch relocation algorithms by the kind of relocation
+         * @tparam Type type whose objects are relocated
+         */
+        template<typename Type>
+        using Kind = std::integral_constant<RelocationKind, relocation_kind<Type>::value>;
+
+        /**
+         * @brief Tag telling whether the objects may be shifted inside an array by {@link shiftRight()}
+         * and {@link shiftLeft()} which cannot throw for them
+         * @tparam Type type whose objects are shifted
+         */
+        template<typename Type>
+        using Shiftable = std::integral_constant<bool, relocation_kind<Type>::value == RelocationKind::BITWISE
+                                                       || relocation_kind<Type>::value == RelocationKind::NOTHROW_MOVE>;
+
+        template<typename Allocator, typename Type>
+        inline void transfer(Allocator& allocator, Type* const source, Type* const target,
+                             std::integral_constant<RelocationKind, RelocationKind::COPY>) {
+            std::allocator_traits<Allocator>::construct(allocator, target, static_cast<Type const&>(*source));
+        }
+
+        template<typename Allocator, typename Type>
+        inline void transfer(Allocator& allocator, Type* const source, Type* const target,
+                             std::integral_constant<RelocationKind, RelocationKind::THROWING_MOVE>) {
+            std::allocator_traits<Allocator>::construct(allocator, target, std::move(*source));
+        }
+
+        /**
+         * @brief Constructs the objects at the target from the ones of the source range which are kept
+         * @param allocator allocator used to construct and destroy the objects
+         * @param source first transferred object
+         * @param count number of transferred objects
+         * @param target uninitialized memory not overlapping the source range
+         *
+         * @note either all or none of the objects get constructed
+         */
+        template<typename Allocator, typename Type, typename Kind>
+        void transfer(Allocator& allocator, Type* const source, size_t const count, Type* const target, Kind) {
+            typedef std::allocator_traits<Allocator> Memory;
+
+            size_t constructed = 0;
+            try {
+                for (; constructed < count; ++constructed) {
+                    transfer(allocator, source + constructed, target + constructed, Kind{});
+                }
+            } catch (...) {
+                for (size_t i = 0; i < constructed; ++i) Memory::destroy(allocator, target + i);
+                throw;
+            }
+        }
+
+        template<typename Allocator, typename Type>
+        inline void destroy(Allocator& allocator, Type* const first, size_t const count) noexcept {
+            typedef std::allocator_traits<Allocator> Memory;
+
+            for (size_t i = 0; i < count; ++i) Memory::destroy(allocator, first + i);
+        }
+
+        template<typename Allocator, typename Type>
+        inline void relocate(Allocator&, Type* const source, size_t const count, Type* const target,
+                             std::true_type) noexcept {
+            if (count != 0) {
+                std::memcpy(static_cast<void*>(target), static_cast<void const*>(source), count * sizeof(Type));
+            }
+        }
+
+        template<typename Allocator, typename Type>
+        inline void relocate(Allocator& allocator, Type* const source, size_t const count, Type* const target,
+                             std::false_type) noexcept {
+            typedef std::allocator_traits<Allocator> Memory;
+
+            Type* const sourceEnd = source + count;
+            for (Type *from = source, *to = target; from != sourceEnd; ++from, ++to) {
+                Memory::construct(allocator, to, std::move(*from));
+                Memory::destroy(allocator, from);
+            }
+        }
+
+        template<typename Allocator, typename Type>
+        inline void relocate(Allocator& allocator, Type* const source, size_t const count, Type* const target,
+                             std::integral_constant<RelocationKind, RelocationKind::BITWISE>) noexcept {
+            relocate(allocator, source, count, target, std::true_type{});
+        }
+
+        template<typename Allocator, typename Type>
+        inline void relocate(Allocator& allocator, Type* const source, size_t const count, Type* const target,
+                             std::integral_constant<RelocationKind, RelocationKind::NOTHROW_MOVE>) noexcept {
+            relocate(allocator, source, count, target, std::false_type{});
+        }
+
+        template<typename Allocator, typename Type, typename Kind>
+        inline void relocate(Allocator& allocator, Type* const source, size_t const count, Type* const target,
+                             Kind) {
+            // the sources get destroyed only once all of the objects have been constructed at the target
+            transfer(allocator, source, count, target, Kind{});
+            destroy(allocator, source, count);
+        }
+
+        /**
+         * @brief Relocates the objects from the source range into uninitialized memory at the target
+         * so that the source range is left uninitialized
+         * @param allocator allocator used to construct and destroy the objects
+         * @param source first object to relocate
+         * @param count number of objects to relocate
+         * @param target uninitialized memory not overlapping the source range
+         *
+         * @note if the objects cannot be relocated without throwing, they get copied (or moved if they are not
+         * copyable) so that either all of them get relocated or the exception is thrown leaving the source range
+         * as it was
+         */
+        template<typename Allocator, typename Type>
+        inline void relocate(Allocator& allocator, Type* const source, size_t const count, Type* const target) {
+            relocate(allocator, source, count, target, Kind<Type>{});
+        }
+
+        template<typename Allocator, typename Type>
+        inline void relocateAround(Allocator& allocator, Type* const source, size_t const count, size_t const index,
+                                   Type* const target, size_t const gap,
+                                   std::integral_constant<RelocationKind, RelocationKind::BITWISE>) noexcept {
+            relocate(allocator, source, index, target, std::true_type{});
+            relocate(allocator, source + index, count - index, target + index + gap, std::true_type{});
+        }
+
+        template<typename Allocator, typename Type>
+        inline void relocateAround(Allocator& allocator, Type* const source, size_t const count, size_t const index,
+                                   Type* const target, size_t const gap,
+                                   std::integral_constant<RelocationKind, RelocationKind::NOTHROW_MOVE>) noexcept {
+            relocate(allocator, source, index, target, std::false_type{});
+            relocate(allocator, source + index, count - index, target + index + gap, std::false_type{});
+        }
+
+        template<typename Allocator, typename Type, typename Kind>
+        void relocateAround(Allocator& allocator, Type* const source, size_t const count, size_t const index,
+                            Type* const target, size_t const gap, Kind) {
+            transfer(allocator, source, index, target, Kind{});
+            try {
+                transfer(allocator, source + index, count - index, target + index + gap, Kind{});
+            } catch (...) {
+                destroy(allocator, target, index);
+                throw;
+            }
+            destroy(allocator, source, count);
+        }
+
+        /**
+         * @brief Relocates the objects from the source range into uninitialized memory at the target
+         * leaving a gap of uninitialized slots at the given index
+         * @param allocator allocator used to construct and destroy the objects
+         * @param source first object to relocate
+         * @param count number of objects to relocate
+         * @param index index of the first object which gets relocated after the gap
+         * @param target uninitialized memory not overlapping the source range
+         * @param gap number of slots in the gap
+         *
+         * @note similarly to {@link #relocate()} either all or none of the objects get relocated
+         */
+        template<typename Allocator, typename Type>
+        inline void relocateAround(Allocator& allocator, Type* const source, size_t const count, size_t const index,
+                                   Type* const target, size_t const gap) {
+            relocateAround(allocator, source, count, index, target, gap, Kind<Type>{});
+        }
+
+        template<typename Allocator, typename Type>
+        inline void relocateJoined(Allocator& allocator, Type* const first, size_t const firstCount, Type* const second,
+                                   size_t const secondCount, Type* const target,
+                                   std::integral_constant<RelocationKind, RelocationKind::BITWISE>) noexcept {
+            relocate(allocator, first, firstCount, target, std::true_type{});
+            relocate(allocator, second, secondCount, target + firstCount, std::true_type{});
+        }
+
+        template<typename Allocator, typename Type>
+        inline void relocateJoined(Allocator& allocator, Type* const first, size_t const firstCount, Type* const second,
+                                   size_t const secondCount, Type* const target,
+                                   std::integral_constant<RelocationKind, RelocationKind::NOTHROW_MOVE>) noexcept {
+            relocate(allocator, first, firstCount, target, std::false_type{});
+            relocate(allocator, second, secondCount, target + firstCount, std::false_type{});
+        }
+
+        template<typename Allocator, typename Type, typename Kind>
+        void relocateJoined(Allocator& allocator, Type* const first, size_t const firstCount, Type* const second,
+                            size_t const secondCount, Type* const target, Kind) {
+            transfer(allocator, first, firstCount, target, Kind{});
+            try {
+                transfer(allocator, second, secondCount, target + firstCount, Kind{});
+            } catch (...) {
+                destroy(allocator, target, firstCount);
+                throw;
+            }
+            destroy(allocator, first, firstCount);
+            destroy(allocator, second, secondCount);
+        }
+
+        /**
+         * @brief Relocates the objects from two source ranges into uninitialized memory at the target
+         * so that the objects of the second range follow the ones of the first range
+         * @param allocator allocator used to construct and destroy the objects
+         * @param first first object of the first range
+         * @param firstCount number of objects in the first range
+         * @param second first object of the second range
+         * @param secondCount number of objects in the second range
+         * @param target uninitialized memory not overlapping any of the source ranges
+         *
+         * @note similarly to {@link #relocate()} either all or none of the objects get relocated
+         */
+        template<typename Allocator, typename Type>
+        inline void relocateJoined(Allocator& allocator, Type* const first, size_t const firstCount, Type* const second,
+                                   size_t const secondCount, Type* const target) {
+            relocateJoined(allocator, first, firstCount, second, secondCount, target, Kind<Type>{});
+        }
+
+        /**
+         * @brief Shifts the constructed objects of the range {@code [position, end)} by {@code count} slots
+         * to the right so that {@code [position, position + count)} is left uninitialized
+         * @param allocator allocator used to construct and destroy the objects
+         * @param position first object to shift
+         * @param end end of the shifted range, there should be {@code count} uninitialized slots after it
+         * @param count number of slots by which the objects get shifted
+         *
+         * @note only {@link Shiftable} types may be shifted as a throwing move would leave a hole in the array
+         */
+        template<typename Allocator, typename Type>
+        inline void shiftRight(Allocator&, Type* const position, Type* const end, size_t const count,
+                               std::true_type) noexcept {
+            std::memmove(static_cast<void*>(position + count), static_cast<void const*>(position),
+                         (end - position) * sizeof(Type));
+        }
+
+        template<typename Allocator, typename Type>
+        inline void shiftRight(Allocator& allocator, Type* const position, Type* const end, size_t const count,
+                               std::false_type) noexcept {
+            typedef std::allocator_traits<Allocator> Memory;
+
+            // walk from the right so that no object gets overwritten before being moved
+            for (Type* source = end; source != position;) {
+                --source;
+                Memory::construct(allocator, source + count, std::move(*source));
+                Memory::destroy(allocator, source);
+            }
+        }
+
+        template<typename Allocator, typename Type>
+        inline void shiftRight(Allocator& allocator, Type* const position, Type* const end,
+                               size_t const count) noexcept {
+            static_assert(Shiftable<Type>::value, "objects should be relocated without throwing to be shifted");
+
+            // moving the objects onto themselves would destroy them
+            if (count != 0 && position != end) shiftRight(allocator, position, end, count, Bitwise<Type>{});
+        }
+
+        /**
+         * @brief Shifts the constructed objects of the range {@code [position, end)} by {@code count} slots
+         * to the left into the uninitialized slots {@code [position - count, position)}
+         * so that {@code [end - count, end)} is left uninitialized
+         * @param allocator allocator used to construct and destroy the objects
+         * @param position first object to shift
+         * @param end end of the shifted range
+         * @param count number of slots by which the objects get shifted
+         *
+         * @note only {@link Shiftable} types may be shifted as a throwing move would leave a hole in the array
+         */
+        template<typename Allocator, typename Type>
+        inline void shiftLeft(Allocator&, Type* const position, Type* const end, size_t const count,
+                              std::true_type) noexcept {
+            std::memmove(static_cast<void*>(position - count), static_cast<void const*>(position),
+                         (end - position) * sizeof(Type));
+        }
+
+        template<typename Allocator, typename Type>
+        inline void shiftLeft(Allocator& allocator, Type* const position, Type* const end, size_t const count,
+                              std::false_type) noexcept {
+            typedef std::allocator_traits<Allocator> Memory;
+
+            for (Type* source = position; source != end; ++source) {
+                Memory::construct(allocator, source - count, std::move(*source));
+                Memory::destroy(allocator, source);
+            }
+        }
+
+        template<typename Allocator, typename Type>
+        inline void shiftLeft(Allocator& allocator, Type* const position, Type* const end,
+                              size_t const count) noexcept {
+            static_assert(Shiftable<Type>::value, "objects should be relocated without throwing to be shifted");
+
+            // moving the objects onto themselves would destroy them
+            if (count != 0 && position != end) shiftLeft(allocator, position, end, count, Bitwise<Type>{});
+        }
+    } // namespace relocation
+} // namespace collection
+
+#endif //INCLUDE_RELOCATION_H_
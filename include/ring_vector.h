@@ -0,0 +1,573 @@
+#ifndef INCLUDE_RING_VECTOR_H_
+#define INCLUDE_RING_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <checks.h>
+#include <growth_policy.h>
+#include <index_iterator.h>
+#include <relocation.h>
+#include <vector.h>
+#include <vector_ref.h>
+
+namespace collection {
+
+    /**
+     * @brief Double-ended queue storing its elements in a single array used as a circular buffer
+     * so that elements get added and removed at both ends in constant time
+     *
+     * The elements start at some slot of the array and wrap around its end so they are contiguous
+     * only until the next wrapping, {@link #linearize()} makes them contiguous again.
+     *
+     * @tparam Value type of stored value
+     * @tparam Allocator type of used allocator
+     * @tparam GrowthPolicy policy deciding on the capacity of the allocated arrays
+     */
+    template<typename Value, typename Allocator = std::allocator<Value>, typename GrowthPolicy = DefaultGrowthPolicy>
+    class RingVector : protected detail::AllocatorHolder<Allocator> {
+        typedef detail::AllocatorHolder<Allocator> AllocatorHolder;
+
+    protected:
+        using AllocatorHolder::allocator;
+
+    public:
+        typedef Value ValueType;
+        typedef Value value_type;
+        typedef Value& reference;
+        typedef Value const& ConstReference;
+        typedef Value&& RValueReference;
+        typedef Value* Pointer;
+        typedef Value const* ConstPointer;
+        typedef Allocator AllocatorType;
+        typedef std::allocator_traits<AllocatorType> Memory;
+        typedef GrowthPolicy GrowthPolicyType;
+
+        /**
+         * @brief Random access iterator over the elements in their logical order
+         */
+        typedef detail::IndexIterator<RingVector, reference, Pointer> Iterator;
+        typedef detail::IndexIterator<RingVector const, ConstReference, ConstPointer> ConstIterator;
+
+    protected:
+        /**
+         * @brief Array of the elements or {@code nullptr} if there is no capacity
+         */
+        Pointer array_;
+        /**
+         * @brief Number of the slots in the array
+         */
+        size_t capacity_;
+        /**
+         * @brief Index of the slot holding the first element
+         */
+        size_t head_;
+        /**
+         * @brief Number of the elements
+         */
+        size_t size_;
+
+        /* ************************************************* Checks ************************************************* */
+
+        inline void checkRange(size_t const index) const {
+            if (index >= size_) detail::throwOutOfRange(index, size_);
+        }
+
+        inline void checkNotEmpty() const {
+            if (size_ == 0) detail::throwOutOfRangeEmpty();
+        }
+
+        static void checkLength(size_t const requiredSize) {
+            if (requiredSize > maxSize()) detail::throwLengthError(requiredSize);
+        }
+
+        /**
+         * @brief Checks the index passed to the unchecked accessors if {@code COLLECTION_VECTOR_CHECKS} is at least 2
+         * @param index index of the accessed element
+         */
+        inline void checkAccess(size_t const index) const {
+#if COLLECTION_VECTOR_CHECKS >= 2
+            checkRange(index);
+#else
+            static_cast<void>(index);
+#endif
+        }
+
+        template<typename, typename, typename>
+        friend class detail::IndexIterator;
+
+        reference elementAt(size_t const index) { return (*this)[index]; }
+
+        ConstReference elementAt(size_t const index) const { return (*this)[index]; }
+
+        /* ***************************************** Internal modification ****************************************** */
+
+        /**
+         * @brief Gets the slot of the array holding the element at the given index
+         * @param index index of the element which may also be equal to the size
+         * @return index of the slot
+         */
+        size_t slotOf(size_t const index) const noexcept {
+            // the capacity never exceeds the half of the addressable range so this does not overflow
+            auto const slot = head_ + index;
+
+            return slot >= capacity_ ? slot - capacity_ : slot;
+        }
+
+        /**
+         * @brief Gets the number of the elements stored before the end of the array
+         */
+        size_t firstPartSize() const noexcept { return std::min(size_, capacity_ - head_); }
+
+        /**
+         * @brief Deallocates the current array (if any) without destroying its elements
+         */
+        void releaseArray() noexcept {
+            if (array_ != nullptr) Memory::deallocate(allocator(), array_, capacity_);
+        }
+
+        void destroyElements() noexcept {
+            auto const firstSize = firstPartSize();
+            relocation::destroy(allocator(), array_ + head_, firstSize);
+            relocation::destroy(allocator(), array_, size_ - firstSize);
+        }
+
+        /**
+         * @brief Relocates the elements into the new array so that they start at the given slot in their logical order
+         * @param newArray array of at least {@code offset + size()} slots
+         * @param offset slot to which the first element gets relocated
+         *
+         * @note either all or none of the elements get relocated
+         */
+        void relocateInto(Pointer const newArray, size_t const offset) {
+            auto const firstSize = firstPartSize();
+            relocation::relocateJoined(allocator(), array_ + head_, firstSize, array_, size_ - firstSize,
+                                       newArray + offset);
+        }
+
+        /**
+         * @brief Replaces the array by the one to which the elements have been relocated
+         * @param newArray array holding the elements starting at its first slot
+         * @param newCapacity capacity of the new array
+         */
+        void replaceArray(Pointer const newArray, size_t const newCapacity) noexcept {
+            releaseArray();
+            array_ = newArray;
+            capacity_ = newCapacity;
+            head_ = 0;
+        }
+
+        /**
+         * @brief Moves the elements into a new array of the given capacity so that they start at its first slot
+         * @param newCapacity capacity of the new array, should not be less than the size
+         */
+        void reallocate(size_t const newCapacity) {
+            if (newCapacity == 0) {
+                replaceArray(nullptr, 0);
+                return;
+            }
+
+            Pointer const newArray = Memory::allocate(allocator(), newCapacity);
+            try {
+                relocateInto(newArray, 0);
+            } catch (...) {
+                // the elements are left intact so only the new array has to be released
+                Memory::deallocate(allocator(), newArray, newCapacity);
+                throw;
+            }
+            replaceArray(newArray, newCapacity);
+        }
+
+        /**
+         * @brief Reallocates the full array constructing a new element at its logical end
+         * @param index index of the new element which is either {@code 0} or the size
+         * @param arguments arguments used to construct the element, they may refer to the elements of this vector
+         * @return reference to the constructed element
+         */
+        template<typename... Arguments>
+        reference emplaceReallocating(size_t const index, Arguments&&... arguments) {
+            auto const newCapacity = grownCapacity(size_ + 1);
+            Pointer const newArray = Memory::allocate(allocator(), newCapacity);
+            // the element is constructed first as the arguments may refer to the elements which get relocated
+            try {
+                Memory::construct(allocator(), newArray + index, std::forward<Arguments>(arguments)...);
+            } catch (...) {
+                Memory::deallocate(allocator(), newArray, newCapacity);
+                throw;
+            }
+            try {
+                relocateInto(newArray, index == 0 ? 1 : 0);
+            } catch (...) {
+                Memory::destroy(allocator(), newArray + index);
+                Memory::deallocate(allocator(), newArray, newCapacity);
+                throw;
+            }
+            replaceArray(newArray, newCapacity);
+            ++size_;
+
+            return newArray[index];
+        }
+
+        /**
+         * @brief Shrinks the array if the growth policy considers too much of its capacity unused
+         */
+        void shrinkAfterRemoval() {
+            auto const newCapacity = GrowthPolicyTraits<GrowthPolicy>::shrink(size_, capacity_, sizeof(ValueType));
+            if (newCapacity < capacity_) reallocate(newCapacity);
+        }
+
+        /**
+         * @brief Calculates the capacity to which the array should grow to fit the given number of elements
+         * @param requiredSize number of elements which should fit the array
+         * @return new capacity not less than {@code requiredSize}
+         */
+        size_t grownCapacity(size_t const requiredSize) const {
+            checkLength(requiredSize);
+
+            return std::min(GrowthPolicy::grow(capacity_, requiredSize, sizeof(ValueType)), maxSize());
+        }
+
+        /**
+         * @brief Calculates the capacity which should be allocated for the explicitly requested number of elements
+         * @param requiredSize number of elements which should fit the array
+         * @return new capacity not less than {@code requiredSize}
+         */
+        static size_t fittingCapacity(size_t const requiredSize) {
+            checkLength(requiredSize);
+
+            return std::min(GrowthPolicy::fit(requiredSize, sizeof(ValueType)), maxSize());
+        }
+
+        /* ******************************************* Allocator handling ******************************************* */
+
+        /**
+         * @brief Tells whether the arrays allocated by the allocators of this and the other vector are interchangeable
+         * @param other other vector
+         */
+        bool sharesAllocator(RingVector const& other) const noexcept {
+            return Memory::is_always_equal::value || allocator() == other.allocator();
+        }
+
+        /**
+         * @brief Takes the array of the other vector which is known to be deallocatable by this vector's allocator
+         * @param other vector whose array gets taken leaving it empty
+         *
+         * @note this vector should have no array
+         */
+        void stealArray(RingVector& other) noexcept {
+            array_ = std::exchange(other.array_, nullptr);
+            capacity_ = std::exchange(other.capacity_, 0);
+            head_ = std::exchange(other.head_, 0);
+            size_ = std::exchange(other.size_, 0);
+        }
+
+        typedef typename Memory::propagate_on_container_swap PropagateOnSwap;
+
+        void swapAllocators(RingVector& other, std::true_type /* propagate */) noexcept {
+            using std::swap;
+            swap(allocator(), other.allocator());
+        }
+
+        void swapAllocators(RingVector&, std::false_type /* propagate */) noexcept {}
+
+        void swapArrays(RingVector& other) noexcept {
+            using std::swap;
+            swap(array_, other.array_);
+            swap(capacity_, other.capacity_);
+            swap(head_, other.head_);
+            swap(size_, other.size_);
+        }
+
+    public:
+        /* ********************************************** Constructors ********************************************** */
+
+        RingVector() : RingVector(AllocatorType()) {}
+
+        /**
+         * @brief Creates a new empty vector using the given allocator.
+         * @param allocator allocator used by the vector
+         */
+        explicit RingVector(AllocatorType const& allocator)
+            : AllocatorHolder(allocator), array_(nullptr), capacity_(0), head_(0), size_(0) {}
+
+        /**
+         * @brief Creates a vector containing copies of the given values.
+         * @param values values which should be {@bold copied} into this vector
+         */
+        RingVector(std::initializer_list<ValueType> const values) : RingVector() {
+            reserve(values.size());
+            for (auto const& value : values) emplaceBack(value);
+        }
+
+        RingVector(RingVector const& other)
+            : RingVector(Memory::select_on_container_copy_construction(other.allocator())) {
+            reserve(other.size_);
+            for (auto const& value : other) emplaceBack(value);
+        }
+
+        RingVector(RingVector&& other) noexcept : RingVector(other.allocator()) { stealArray(other); }
+
+        ~RingVector() {
+            destroyElements();
+            releaseArray();
+        }
+
+        /**
+         * @brief Copy-assigns the elements of the other vector either fully or not at all keeping the allocator.
+         * @param other vector whose elements should be {@bold copied} into this one
+         */
+        RingVector& operator=(RingVector const& other) {
+            if (this != &other) {
+                RingVector copy(allocator());
+                copy.reserve(other.size_);
+                for (auto const& value : other) copy.emplaceBack(value);
+                swapArrays(copy);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Move-assigns the elements of the other vector keeping the allocator
+         * so that the array is taken only if it can be deallocated by this vector's allocator.
+         * @param other vector whose elements should be {@bold moved} into this one
+         */
+        RingVector& operator=(RingVector&& other) noexcept(Memory::is_always_equal::value) {
+            if (this != &other) {
+                if (sharesAllocator(other)) {
+                    clear();
+                    releaseArray();
+                    stealArray(other);
+                } else {
+                    RingVector moved(allocator());
+                    moved.reserve(other.size_);
+                    for (auto& value : other) moved.emplaceBack(std::move(value));
+                    swapArrays(moved);
+                    other.clear();
+                }
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Swaps the elements of this and the other vector, the allocators are swapped only if they propagate.
+         * @param other vector whose contents get swapped with this one's
+         *
+         * @note if the allocators neither propagate nor are equal, the elements get moved one by one
+         */
+        void swap(RingVector& other) noexcept(PropagateOnSwap::value || Memory::is_always_equal::value) {
+            if (PropagateOnSwap::value || sharesAllocator(other)) {
+                swapAllocators(other, PropagateOnSwap{});
+                swapArrays(other);
+            } else {
+                // arrays cannot be exchanged so the elements get moved between the allocators
+                RingVector temporary(std::move(other));
+                other = std::move(*this);
+                *this = std::move(temporary);
+            }
+        }
+
+        AllocatorType getAllocator() const noexcept { return this->allocator(); }
+
+        /* ********************************************* Indexed access ********************************************* */
+
+        /**
+         * @brief Gets the element at the given index counting from the front.
+         * @param index index of the element
+         * @return reference to the element
+         */
+        reference operator[](size_t const index) {
+            checkAccess(index);
+
+            return array_[slotOf(index)];
+        }
+
+        ConstReference operator[](size_t const index) const {
+            checkAccess(index);
+
+            return array_[slotOf(index)];
+        }
+
+        reference at(size_t const index) {
+            checkRange(index);
+
+            return array_[slotOf(index)];
+        }
+
+        ConstReference at(size_t const index) const {
+            checkRange(index);
+
+            return array_[slotOf(index)];
+        }
+
+        reference front() {
+            checkNotEmpty();
+
+            return array_[head_];
+        }
+
+        ConstReference front() const {
+            checkNotEmpty();
+
+            return array_[head_];
+        }
+
+        reference back() {
+            checkNotEmpty();
+
+            return array_[slotOf(size_ - 1)];
+        }
+
+        ConstReference back() const {
+            checkNotEmpty();
+
+            return array_[slotOf(size_ - 1)];
+        }
+
+        /* *********************************************** Iterators ************************************************ */
+
+        Iterator begin() noexcept { return Iterator(this, 0); }
+
+        Iterator end() noexcept { return Iterator(this, size_); }
+
+        ConstIterator begin() const noexcept { return ConstIterator(this, 0); }
+
+        ConstIterator end() const noexcept { return ConstIterator(this, size_); }
+
+        ConstIterator cbegin() const noexcept { return begin(); }
+
+        ConstIterator cend() const noexcept { return end(); }
+
+        /* ********************************************* Data accessors ********************************************* */
+
+        bool empty() const noexcept { return size_ == 0; }
+
+        size_t size() const noexcept { return size_; }
+
+        size_t capacity() const noexcept { return capacity_; }
+
+        static constexpr size_t maxSize() noexcept {
+            // keeping the capacity within the half of the range lets the slots be computed without overflow
+            return std::numeric_limits<size_t>::max() / 2 / sizeof(ValueType);
+        }
+
+        /**
+         * @brief Tells whether the elements are stored contiguously, i.e. they do not wrap around the end of the array.
+         */
+        bool isLinear() const noexcept { return head_ + size_ <= capacity_; }
+
+        /**
+         * @brief Makes the elements contiguous by moving them to the beginning of a new array if they wrap around.
+         * @return view of the elements in their logical order which is valid until the next modification
+         *
+         * @note the elements are not moved if they are already contiguous
+         */
+        MutableVectorView<ValueType> linearize() {
+            if (!isLinear()) reallocate(capacity_);
+
+            return MutableVectorView<ValueType>(array_ + head_, size_);
+        }
+
+        /* *********************************************** Modifiers ************************************************ */
+
+        /**
+         * @brief Makes sure that the given number of elements fits without reallocation.
+         * @param newCapacity required capacity
+         */
+        void reserve(size_t const newCapacity) {
+            if (newCapacity > capacity_) reallocate(fittingCapacity(newCapacity));
+        }
+
+        template<typename... Arguments>
+        reference emplaceBack(Arguments&&... arguments) {
+            if (size_ == capacity_) return emplaceReallocating(size_, std::forward<Arguments>(arguments)...);
+
+            auto* const address = array_ + slotOf(size_);
+            Memory::construct(allocator(), address, std::forward<Arguments>(arguments)...);
+            ++size_;
+
+            return *address;
+        }
+
+        template<typename... Arguments>
+        reference emplaceFront(Arguments&&... arguments) {
+            if (size_ == capacity_) return emplaceReallocating(0, std::forward<Arguments>(arguments)...);
+
+            auto const newHead = head_ == 0 ? capacity_ - 1 : head_ - 1;
+            auto* const address = array_ + newHead;
+            Memory::construct(allocator(), address, std::forward<Arguments>(arguments)...);
+            head_ = newHead;
+            ++size_;
+
+            return *address;
+        }
+
+        void pushBack(ConstReference value) { emplaceBack(value); }
+
+        void pushBack(RValueReference value) { emplaceBack(std::forward<RValueReference>(value)); }
+
+        void pushFront(ConstReference value) { emplaceFront(value); }
+
+        void pushFront(RValueReference value) { emplaceFront(std::forward<RValueReference>(value)); }
+
+        void popBack() {
+#if COLLECTION_VECTOR_CHECKS >= 1
+            checkNotEmpty();
+#endif
+
+            Memory::destroy(allocator(), array_ + slotOf(--size_));
+            if (size_ == 0) head_ = 0;
+            shrinkAfterRemoval();
+        }
+
+        void popFront() {
+#if COLLECTION_VECTOR_CHECKS >= 1
+            checkNotEmpty();
+#endif
+
+            Memory::destroy(allocator(), array_ + head_);
+            // restarting at the first slot once empty keeps the elements contiguous as long as possible
+            head_ = --size_ == 0 || head_ + 1 == capacity_ ? 0 : head_ + 1;
+            shrinkAfterRemoval();
+        }
+
+        void clear() noexcept {
+            destroyElements();
+            head_ = 0;
+            size_ = 0;
+        }
+
+        /**
+         * @brief Releases the unused capacity.
+         */
+        void shrinkToFit() {
+            auto const newCapacity = fittingCapacity(size_);
+            if (newCapacity < capacity_) reallocate(newCapacity);
+        }
+    };
+
+    /* ************************************************* Comparison ************************************************* */
+
+    template<typename Value, typename Allocator, typename GrowthPolicy>
+    bool operator==(RingVector<Value, Allocator, GrowthPolicy> const& left,
+                    RingVector<Value, Allocator, GrowthPolicy> const& right) {
+        return left.size() == right.size() && std::equal(left.begin(), left.end(), right.begin());
+    }
+
+    template<typename Value, typename Allocator, typename GrowthPolicy>
+    bool operator!=(RingVector<Value, Allocator, GrowthPolicy> const& left,
+                    RingVector<Value, Allocator, GrowthPolicy> const& right) {
+        return !(left == right);
+    }
+} // namespace collection
+
+#endif //INCLUDE_RING_VECTOR_H_
@@ -0,0 +1,552 @@
+#ifndef INCLUDE_SIMD_H_
+#define INCLUDE_SIMD_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if !defined(COLLECTION_NO_SIMD) && defined(__GNUC__) && defined(__x86_64__)
+#define COLLECTION_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace collection {
+
+    /**
+     * @brief Kernels for bulk operations over contiguous arrays
+     *
+     * Integral types are processed by vector instructions chosen at runtime (SSE2, AVX2 or AVX-512BW)
+     * while all other types (including floating-point ones whose equality is not bitwise) fall back
+     * to plain loops using their operators. Defining {@code COLLECTION_NO_SIMD} disables the vector kernels.
+     */
+    namespace simd {
+
+        /**
+         * @brief Tells whether the values of the type are equal if and only if their bytes are
+         * so that they can be processed by the vector kernels
+         */
+        template<typename Value>
+        struct IsVectorizable
+            : std::integral_constant<bool, std::is_integral<Value>::value
+                                                   && (sizeof(Value) == 1 || sizeof(Value) == 2
+                                                       || sizeof(Value) == 4 || sizeof(Value) == 8)> {};
+
+        namespace detail {
+
+            /* ********************************************** Scalar ********************************************** */
+
+            template<typename Value>
+            size_t findScalar(Value const* const data, size_t const count, Value const& value) {
+                size_t i = 0;
+                while (i < count && !(data[i] == value)) ++i;
+
+                return i;
+            }
+
+            template<typename Value>
+            size_t countScalar(Value const* const data, size_t const count, Value const& value) {
+                size_t result = 0;
+                for (size_t i = 0; i < count; ++i) if (data[i] == value) ++result;
+
+                return result;
+            }
+
+            template<typename Value>
+            size_t mismatchScalar(Value const* const left, Value const* const right, size_t const count) {
+                size_t i = 0;
+                while (i < count && left[i] == right[i]) ++i;
+
+                return i;
+            }
+
+            template<typename Value>
+            void fillScalar(Value* const data, size_t const count, Value const value) noexcept {
+                for (size_t i = 0; i < count; ++i) data[i] = value;
+            }
+
+#if defined(COLLECTION_SIMD_X86)
+            /* *********************************************** SSE2 *********************************************** */
+
+            // SSE2 is a part of x86-64 so these need no runtime check
+
+            template<typename Value>
+            using Width = std::integral_constant<size_t, sizeof(Value)>;
+
+            inline __m128i broadcast128(std::uint64_t const value, std::integral_constant<size_t, 1>) noexcept {
+                return _mm_set1_epi8(static_cast<char>(value));
+            }
+
+            inline __m128i broadcast128(std::uint64_t const value, std::integral_constant<size_t, 2>) noexcept {
+                return _mm_set1_epi16(static_cast<short>(value));
+            }
+
+            inline __m128i broadcast128(std::uint64_t const value, std::integral_constant<size_t, 4>) noexcept {
+                return _mm_set1_epi32(static_cast<int>(value));
+            }
+
+            inline __m128i broadcast128(std::uint64_t const value, std::integral_constant<size_t, 8>) noexcept {
+                return _mm_set1_epi64x(static_cast<long long>(value));
+            }
+
+            inline __m128i equal128(__m128i const left, __m128i const right, std::integral_constant<size_t, 1>) {
+                return _mm_cmpeq_epi8(left, right);
+            }
+
+            inline __m128i equal128(__m128i const left, __m128i const right, std::integral_constant<size_t, 2>) {
+                return _mm_cmpeq_epi16(left, right);
+            }
+
+            inline __m128i equal128(__m128i const left, __m128i const right, std::integral_constant<size_t, 4>) {
+                return _mm_cmpeq_epi32(left, right);
+            }
+
+            inline __m128i equal128(__m128i const left, __m128i const right, std::integral_constant<size_t, 8>) {
+                // 64-bit lanes are equal if both of their 32-bit halves are
+                auto const halves = _mm_cmpeq_epi32(left, right);
+
+                return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+
+            inline __m128i load128(void const* const address) noexcept {
+                return _mm_loadu_si128(static_cast<__m128i const*>(address));
+            }
+
+            /**
+             * @brief Compares the values of the block bytewise with one bit per byte of the result
+             */
+            template<typename Value>
+            unsigned equalMask128(Value const* const data, __m128i const needle) noexcept {
+                return static_cast<unsigned>(_mm_movemask_epi8(equal128(load128(data), needle, Width<Value>{})));
+            }
+
+            template<typename Value>
+            size_t findSse2(Value const* const data, size_t const count, Value const value) noexcept {
+                constexpr size_t lanes = 16 / sizeof(Value);
+                auto const needle = broadcast128(static_cast<std::uint64_t>(value), Width<Value>{});
+
+                size_t i = 0;
+                for (; i + lanes <= count; i += lanes) {
+                    auto const mask = equalMask128(data + i, needle);
+                    if (mask != 0) return i + static_cast<size_t>(__builtin_ctz(mask)) / sizeof(Value);
+                }
+
+                return i + findScalar(data + i, count - i, value);
+            }
+
+            template<typename Value>
+            size_t countSse2(Value const* const data, size_t const count, Value const value) noexcept {
+                constexpr size_t lanes = 16 / sizeof(Value);
+                auto const needle = broadcast128(static_cast<std::uint64_t>(value), Width<Value>{});
+
+                size_t result = 0, i = 0;
+                for (; i + lanes <= count; i += lanes) {
+                    result += static_cast<size_t>(__builtin_popcount(equalMask128(data + i, needle)));
+                }
+
+                return result / sizeof(Value) + countScalar(data + i, count - i, value);
+            }
+
+            template<typename Value>
+            size_t mismatchSse2(Value const* const left, Value const* const right, size_t const count) noexcept {
+                constexpr size_t lanes = 16 / sizeof(Value);
+
+                size_t i = 0;
+                for (; i + lanes <= count; i += lanes) {
+                    auto const mask = ~static_cast<unsigned>(_mm_movemask_epi8(
+                                              equal128(load128(left + i), load128(right + i), Width<Value>{})))
+                                      & 0xFFFFu;
+                    if (mask != 0) return i + static_cast<size_t>(__builtin_ctz(mask)) / sizeof(Value);
+                }
+
+                return i + mismatchScalar(left + i, right + i, count - i);
+            }
+
+            template<typename Value>
+            void fillSse2(Value* const data, size_t const count, Value const value) noexcept {
+                constexpr size_t lanes = 16 / sizeof(Value);
+                auto const pattern = broadcast128(static_cast<std::uint64_t>(value), Width<Value>{});
+
+                size_t i = 0;
+                for (; i + lanes <= count; i += lanes) _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), pattern);
+                fillScalar(data + i, count - i, value);
+            }
+
+            /* *********************************************** AVX2 *********************************************** */
+
+            __attribute__((target("avx2"))) inline __m256i broadcast256(std::uint64_t const value,
+                                                                        std::integral_constant<size_t, 1>) noexcept {
+                return _mm256_set1_epi8(static_cast<char>(value));
+            }
+
+            __attribute__((target("avx2"))) inline __m256i broadcast256(std::uint64_t const value,
+                                                                        std::integral_constant<size_t, 2>) noexcept {
+                return _mm256_set1_epi16(static_cast<short>(value));
+            }
+
+            __attribute__((target("avx2"))) inline __m256i broadcast256(std::uint64_t const value,
+                                                                        std::integral_constant<size_t, 4>) noexcept {
+                return _mm256_set1_epi32(static_cast<int>(value));
+            }
+
+            __attribute__((target("avx2"))) inline __m256i broadcast256(std::uint64_t const value,
+                                                                        std::integral_constant<size_t, 8>) noexcept {
+                return _mm256_set1_epi64x(static_cast<long long>(value));
+            }
+
+            __attribute__((target("avx2"))) inline __m256i equal256(__m256i const left, __m256i const right,
+                                                                    std::integral_constant<size_t, 1>) noexcept {
+                return _mm256_cmpeq_epi8(left, right);
+            }
+
+            __attribute__((target("avx2"))) inline __m256i equal256(__m256i const left, __m256i const right,
+                                                                    std::integral_constant<size_t, 2>) noexcept {
+                return _mm256_cmpeq_epi16(left, right);
+            }
+
+            __attribute__((target("avx2"))) inline __m256i equal256(__m256i const left, __m256i const right,
+                                                                    std::integral_constant<size_t, 4>) noexcept {
+                return _mm256_cmpeq_epi32(left, right);
+            }
+
+            __attribute__((target("avx2"))) inline __m256i equal256(__m256i const left, __m256i const right,
+                                                                    std::integral_constant<size_t, 8>) noexcept {
+                return _mm256_cmpeq_epi64(left, right);
+            }
+
+            __attribute__((target("avx2"))) inline __m256i load256(void const* const address) noexcept {
+                return _mm256_loadu_si256(static_cast<__m256i const*>(address));
+            }
+
+            template<typename Value>
+            __attribute__((target("avx2"))) unsigned equalMask256(Value const* const data,
+                                                                  __m256i const needle) noexcept {
+                return static_cast<unsigned>(_mm256_movemask_epi8(equal256(load256(data), needle, Width<Value>{})));
+            }
+
+            template<typename Value>
+            __attribute__((target("avx2"))) size_t findAvx2(Value const* const data, size_t const count,
+                                                            Value const value) noexcept {
+                constexpr size_t lanes = 32 / sizeof(Value);
+                auto const needle = broadcast256(static_cast<std::uint64_t>(value), Width<Value>{});
+
+                size_t i = 0;
+                for (; i + lanes <= count; i += lanes) {
+                    auto const mask = equalMask256(data + i, needle);
+                    if (mask != 0) return i + static_cast<size_t>(__builtin_ctz(mask)) / sizeof(Value);
+                }
+
+                return i + findSse2(data + i, count - i, value);
+            }
+
+            template<typename Value>
+            __attribute__((target("avx2"))) size_t countAvx2(Value const* const data, size_t const count,
+                                                             Value const value) noexcept {
+                constexpr size_t lanes = 32 / sizeof(Value);
+                auto const needle = broadcast256(static_cast<std::uint64_t>(value), Width<Value>{});
+
+                size_t result = 0, i = 0;
+                for (; i + lanes <= count; i += lanes) {
+                    result += static_cast<size_t>(__builtin_popcount(equalMask256(data + i, needle)));
+                }
+
+                return result / sizeof(Value) + countSse2(data + i, count - i, value);
+            }
+
+            template<typename Value>
+            __attribute__((target("avx2"))) size_t mismatchAvx2(Value const* const left, Value const* const right,
+                                                                size_t const count) noexcept {
+                constexpr size_t lanes = 32 / sizeof(Value);
+
+                size_t i = 0;
+                for (; i + lanes <= count; i += lanes) {
+                    auto const mask = ~static_cast<unsigned>(_mm256_movemask_epi8(
+                            equal256(load256(left + i), load256(right + i), Width<Value>{})));
+                    if (mask != 0) return i + static_cast<size_t>(__builtin_ctz(mask)) / sizeof(Value);
+                }
+
+                return i + mismatchSse2(left + i, right + i, count - i);
+            }
+
+            template<typename Value>
+            __attribute__((target("avx2"))) void fillAvx2(Value* const data, size_t const count,
+                                                          Value const value) noexcept {
+                constexpr size_t lanes = 32 / sizeof(Value);
+                auto const pattern = broadcast256(static_cast<std::uint64_t>(value), Width<Value>{});
+
+                size_t i = 0;
+                for (; i + lanes <= count; i += lanes) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), pattern);
+                }
+                fillSse2(data + i, count - i, value);
+            }
+
+            /* ********************************************* AVX-512 ********************************************** */
+
+            // AVX-512 comparisons produce one bit per lane rather than per byte
+
+            __attribute__((target("avx512f,avx512bw"))) inline std::uint64_t
+            equalMask512(__m512i const left, __m512i const right, std::integral_constant<size_t, 1>) noexcept {
+                return _mm512_cmpeq_epi8_mask(left, right);
+            }
+
+            __attribute__((target("avx512f,avx512bw"))) inline std::uint64_t
+            equalMask512(__m512i const left, __m512i const right, std::integral_constant<size_t, 2>) noexcept {
+                return _mm512_cmpeq_epi16_mask(left, right);
+            }
+
+            __attribute__((target("avx512f,avx512bw"))) inline std::uint64_t
+            equalMask512(__m512i const left, __m512i const right, std::integral_constant<size_t, 4>) noexcept {
+                return _mm512_cmpeq_epi32_mask(left, right);
+            }
+
+            __attribute__((target("avx512f,avx512bw"))) inline std::uint64_t
+            equalMask512(__m512i const left, __m512i const right, std::integral_constant<size_t, 8>) noexcept {
+                return _mm512_cmpeq_epi64_mask(left, right);
+            }
+
+            template<typename Value>
+            __attribute__((target("avx512f,avx512bw"))) __m512i broadcast512(Value const value) noexcept {
+                Value pattern[64 / sizeof(Value)];
+                for (auto& lane : pattern) lane = value;
+
+                return _mm512_loadu_si512(pattern);
+            }
+
+            template<typename Value>
+            __attribute__((target("avx512f,avx512bw"))) size_t findAvx512(Value const* const data,
+                                                                          size_t const count,
+                                                                          Value const value) noexcept {
+                constexpr size_t lanes = 64 / sizeof(Value);
+                auto const needle = broadcast512(value);
+
+                size_t i = 0;
+                for (; i + lanes <= count; i += lanes) {
+                    auto const mask = equalMask512(_mm512_loadu_si512(data + i), needle, Width<Value>{});
+                    if (mask != 0) return i + static_cast<size_t>(__builtin_ctzll(mask));
+                }
+
+                return i + findAvx2(data + i, count - i, value);
+            }
+
+            template<typename Value>
+            __attribute__((target("avx512f,avx512bw"))) size_t countAvx512(Value const* const data,
+                                                                           size_t const count,
+                                                                           Value const value) noexcept {
+                constexpr size_t lanes = 64 / sizeof(Value);
+                auto const needle = broadcast512(value);
+
+                size_t result = 0, i = 0;
+                for (; i + lanes <= count; i += lanes) {
+                    result += static_cast<size_t>(
+                            __builtin_popcountll(equalMask512(_mm512_loadu_si512(data + i), needle, Width<Value>{})));
+                }
+
+                return result + countAvx2(data + i, count - i, value);
+            }
+
+            template<typename Value>
+            __attribute__((target("avx512f,avx512bw"))) size_t mismatchAvx512(Value const* const left,
+                                                                              Value const* const right,
+                                                                              size_t const count) noexcept {
+                constexpr size_t lanes = 64 / sizeof(Value);
+                constexpr auto all = lanes == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << lanes) - 1;
+
+                size_t i = 0;
+                for (; i + lanes <= count; i += lanes) {
+                    auto const mask = all ^ equalMask512(_mm512_loadu_si512(left + i), _mm512_loadu_si512(right + i),
+                                                         Width<Value>{});
+                    if (mask != 0) return i + static_cast<size_t>(__builtin_ctzll(mask));
+                }
+
+                return i + mismatchAvx2(left + i, right + i, count - i);
+            }
+
+            template<typename Value>
+            __attribute__((target("avx512f,avx512bw"))) void fillAvx512(Value* const data, size_t const count,
+                                                                        Value const value) noexcept {
+                constexpr size_t lanes = 64 / sizeof(Value);
+                auto const pattern = broadcast512(value);
+
+                size_t i = 0;
+                for (; i + lanes <= count; i += lanes) _mm512_storeu_si512(data + i, pattern);
+                fillAvx2(data + i, count - i, value);
+            }
+
+            /* ********************************************* Dispatch ********************************************* */
+
+            enum class InstructionSet { SSE2, AVX2, AVX512 };
+
+            /**
+             * @brief Detects the best instruction set supported by the CPU, the result is cached
+             */
+            inline InstructionSet instructionSet() noexcept {
+                static InstructionSet const detected = [] {
+                    __builtin_cpu_init();
+                    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+                        return InstructionSet::AVX512;
+                    }
+                    if (__builtin_cpu_supports("avx2")) return InstructionSet::AVX2;
+
+                    return InstructionSet::SSE2;
+                }();
+
+                return detected;
+            }
+
+            template<typename Value>
+            size_t find(Value const* const data, size_t const count, Value const& value, std::true_type) noexcept {
+                switch (instructionSet()) {
+                    case InstructionSet::AVX512: return findAvx512(data, count, value);
+                    case InstructionSet::AVX2: return findAvx2(data, count, value);
+                    default: return findSse2(data, count, value);
+                }
+            }
+
+            template<typename Value>
+            size_t count(Value const* const data, size_t const count, Value const& value, std::true_type) noexcept {
+                switch (instructionSet()) {
+                    case InstructionSet::AVX512: return countAvx512(data, count, value);
+                    case InstructionSet::AVX2: return countAvx2(data, count, value);
+                    default: return countSse2(data, count, value);
+                }
+            }
+
+            template<typename Value>
+            size_t mismatch(Value const* const left, Value const* const right, size_t const count,
+                            std::true_type) noexcept {
+                switch (instructionSet()) {
+                    case InstructionSet::AVX512: return mismatchAvx512(left, right, count);
+                    case InstructionSet::AVX2: return mismatchAvx2(left, right, count);
+                    default: return mismatchSse2(left, right, count);
+                }
+            }
+
+            template<typename Value>
+            void fill(Value* const data, size_t const count, Value const value, std::true_type) noexcept {
+                if (sizeof(Value) == 1) {
+                    if (count != 0) std::memset(data, static_cast<unsigned char>(value), count);
+                    return;
+                }
+                switch (instructionSet()) {
+                    case InstructionSet::AVX512: return fillAvx512(data, count, value);
+                    case InstructionSet::AVX2: return fillAvx2(data, count, value);
+                    default: return fillSse2(data, count, value);
+                }
+            }
+#else
+            template<typename Value>
+            size_t find(Value const* const data, size_t const count, Value const& value, std::true_type) noexcept {
+                return findScalar(data, count, value);
+            }
+
+            template<typename Value>
+            size_t count(Value const* const data, size_t const count, Value const& value, std::true_type) noexcept {
+                return countScalar(data, count, value);
+            }
+
+            template<typename Value>
+            size_t mismatch(Value const* const left, Value const* const right, size_t const count,
+                            std::true_type) noexcept {
+                return mismatchScalar(left, right, count);
+            }
+
+            template<typename Value>
+            void fill(Value* const data, size_t const count, Value const value, std::true_type) noexcept {
+                fillScalar(data, count, value);
+            }
+#endif
+
+            template<typename Value>
+            size_t find(Value const* const data, size_t const count, Value const& value, std::false_type) {
+                return findScalar(data, count, value);
+            }
+
+            template<typename Value>
+            size_t count(Value const* const data, size_t const count, Value const& value, std::false_type) {
+                return countScalar(data, count, value);
+            }
+
+            template<typename Value>
+            size_t mismatch(Value const* const left, Value const* const right, size_t const count, std::false_type) {
+                return mismatchScalar(left, right, count);
+            }
+
+            template<typename Value>
+            void fill(Value* const data, size_t const count, Value const value, std::false_type) noexcept {
+                fillScalar(data, count, value);
+            }
+        } // namespace detail
+
+        /**
+         * @brief Finds the first element equal to the value
+         * @param data first element of the array
+         * @param count number of elements in the array
+         * @param value searched value
+         * @return index of the found element or {@code count} if there is none
+         */
+        template<typename Value>
+        size_t find(Value const* const data, size_t const count, Value const& value) {
+            return detail::find(data, count, value, IsVectorizable<Value>{});
+        }
+
+        /**
+         * @brief Counts the elements equal to the value
+         * @param data first element of the array
+         * @param count number of elements in the array
+         * @param value counted value
+         * @return number of the elements equal to {@code value}
+         */
+        template<typename Value>
+        size_t count(Value const* const data, size_t const count, Value const& value) {
+            return detail::count(data, count, value, IsVectorizable<Value>{});
+        }
+
+        /**
+         * @brief Finds the first position at which the arrays differ
+         * @param left first element of the first array
+         * @param right first element of the second array
+         * @param count number of elements in each of the arrays
+         * @return index of the first pair of different elements or {@code count} if the arrays are equal
+         */
+        template<typename Value>
+        size_t mismatch(Value const* const left, Value const* const right, size_t const count) {
+            return detail::mismatch(left, right, count, IsVectorizable<Value>{});
+        }
+
+        /**
+         * @brief Assigns the value to all elements of the array of trivially copyable elements
+         * @param data first element of the array, it may be uninitialized
+         * @param count number of elements in the array
+         * @param value assigned value
+         */
+        template<typename Value>
+        void fill(Value* const data, size_t const count, Value const value) noexcept {
+            static_assert(std::is_trivially_copyable<Value>::value, "Type should be trivially copyable");
+
+            detail::fill(data, count, value, IsVectorizable<Value>{});
+        }
+
+        /**
+         * @brief Compares the arrays lexicographically
+         * @param left first element of the first array
+         * @param leftCount number of elements in the first array
+         * @param right first element of the second array
+         * @param rightCount number of elements in the second array
+         * @return negative number if the first array is less than the second one,
+         * positive number if it is greater and zero if they are equal
+         */
+        template<typename Value>
+        int compare(Value const* const left, size_t const leftCount, Value const* const right,
+                    size_t const rightCount) {
+            auto const commonCount = std::min(leftCount, rightCount);
+            auto const index = mismatch(left, right, commonCount);
+            if (index != commonCount) return left[index] < right[index] ? -1 : 1;
+
+            return leftCount < rightCount ? -1 : leftCount == rightCount ? 0 : 1;
+        }
+    } // namespace simd
+} // namespace collection
+
+#endif //INCLUDE_SIMD_H_
@@ -0,0 +1,270 @@
+#ifndef INCLUDE_SMALL_VECTOR_H_
+#define INCLUDE_SMALL_VECTOR_H_
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <allocator_extensions.h>
+#include <growth_policy.h>
+#include <relocation.h>
+#include <vector.h>
+
+namespace collection {
+
+    namespace detail {
+
+        /**
+         * @brief Allocator serving the first allocation fitting {@code N} objects from an inline buffer
+         * and delegating all other allocations to the base allocator
+         *
+         * @tparam Value type of allocated objects
+         * @tparam N number of objects fitting the inline buffer
+         * @tparam Base type of the allocator used for heap allocations
+         *
+         * @note the buffer is part of the allocator object so that it never gets copied or propagated
+         */
+        template<typename Value, size_t N, typename Base>
+        class SmallBufferAllocator : public std::allocator_traits<Base>::template rebind_alloc<Value> {
+            typedef typename std::allocator_traits<Base>::template rebind_alloc<Value> HeapAllocator;
+            typedef std::allocator_traits<HeapAllocator> HeapMemory;
+            typedef AllocatorExtensions<HeapAllocator> HeapExtensions;
+
+            typename std::aligned_storage<sizeof(Value) * N, alignof(Value)>::type buffer_;
+            bool bufferUsed_ = false;
+
+        public:
+            typedef Value value_type;
+            typedef std::false_type propagate_on_container_copy_assignment;
+            typedef std::false_type propagate_on_container_move_assignment;
+            typedef std::false_type propagate_on_container_swap;
+            typedef std::false_type is_always_equal;
+
+            template<typename Other>
+            struct rebind {
+                typedef SmallBufferAllocator<Other, N, Base> other;
+            };
+
+            SmallBufferAllocator() = default;
+
+            SmallBufferAllocator(SmallBufferAllocator const& original) : HeapAllocator(original.heapAllocator()) {}
+
+            SmallBufferAllocator& operator=(SmallBufferAllocator const& other) {
+                static_cast<HeapAllocator&>(*this) = other.heapAllocator();
+
+                return *this;
+            }
+
+            HeapAllocator const& heapAllocator() const noexcept { return *this; }
+
+            Value* inlineBuffer() noexcept { return reinterpret_cast<Value*>(&buffer_); }
+
+            bool isInline(Value const* const pointer) const noexcept {
+                return pointer == reinterpret_cast<Value const*>(&buffer_);
+            }
+
+            Value* allocate(size_t const count) {
+                if (count <= N && !bufferUsed_) {
+                    bufferUsed_ = true;
+
+                    return inlineBuffer();
+                }
+
+                return HeapMemory::allocate(*this, count);
+            }
+
+            void deallocate(Value* const pointer, size_t const count) noexcept {
+                if (isInline(pointer)) bufferUsed_ = false;
+                else HeapMemory::deallocate(*this, pointer, count);
+            }
+
+            /**
+             * @brief Attempts to extend the block without moving it, the inline buffer never grows
+             * @param pointer pointer to the allocated block
+             * @param oldCapacity number of objects for which the block was allocated
+             * @param newCapacity number of objects which should fit the block
+             * @return {@code true} if the block fits {@code newCapacity} objects and {@code false} otherwise
+             *
+             * @note this hides the base allocator's member so that the inline buffer never reaches it
+             */
+            template<typename Heap = HeapAllocator,
+                     typename = typename std::enable_if<AllocatorExtensions<Heap>::canTryExpand>::type>
+            bool tryExpand(Value* const pointer, size_t const oldCapacity, size_t const newCapacity) {
+                if (isInline(pointer)) return newCapacity <= N;
+
+                return HeapExtensions::tryExpand(*this, pointer, oldCapacity, newCapacity);
+            }
+
+            /**
+             * @brief Resizes the block moving its contents bytewise, the inline buffer gets copied to the heap
+             * @param pointer pointer to the allocated block
+             * @param oldCapacity number of objects for which the block was allocated
+             * @param newCapacity number of objects which should fit the block
+             * @return pointer to the reallocated block
+             *
+             * @note this hides the base allocator's member so that the inline buffer never reaches it
+             */
+            template<typename Heap = HeapAllocator,
+                     typename = typename std::enable_if<AllocatorExtensions<Heap>::canReallocate>::type>
+            Value* reallocate(Value* const pointer, size_t const oldCapacity, size_t const newCapacity) {
+                if (!isInline(pointer)) return HeapExtensions::reallocate(*this, pointer, oldCapacity, newCapacity);
+
+                auto const newPointer = HeapMemory::allocate(*this, newCapacity);
+                std::memcpy(static_cast<void*>(newPointer), static_cast<void const*>(pointer),
+                            sizeof(Value) * (oldCapacity < newCapacity ? oldCapacity : newCapacity));
+                bufferUsed_ = false;
+
+                return newPointer;
+            }
+
+            bool operator==(SmallBufferAllocator const& other) const noexcept { return this == &other; }
+
+            bool operator!=(SmallBufferAllocator const& other) const noexcept { return this != &other; }
+        };
+
+        /**
+         * @brief Growth policy never going below the inline capacity
+         * so that the inline buffer is used whenever the elements fit it
+         * @tparam Base policy of the vector
+         * @tparam N number of objects fitting the inline buffer
+         */
+        template<typename Base, size_t N>
+        struct SmallBufferGrowthPolicy {
+            static constexpr size_t grow(size_t const capacity, size_t const requiredSize, size_t const elementSize) {
+                return Base::grow(capacity, requiredSize, elementSize);
+            }
+
+            static constexpr size_t fit(size_t const requiredSize, size_t const elementSize) {
+                return requiredSize <= N ? N : Base::fit(requiredSize, elementSize);
+            }
+
+            static constexpr size_t shrink(size_t const size, size_t const capacity, size_t const elementSize) {
+                return capacity <= N ? capacity : fit(GrowthPolicyTraits<Base>::shrink(size, capacity, elementSize),
+                                                      elementSize);
+            }
+        };
+    } // namespace detail
+
+    template<typename Value, size_t N, typename Base>
+    struct uses_default_construct<detail::SmallBufferAllocator<Value, N, Base>>
+        : uses_default_construct<typename std::allocator_traits<Base>::template rebind_alloc<Value>> {};
+
+    /**
+     * @brief Vector of elements storing up to {@code N} elements inline and spilling to the heap when they don't fit
+     *
+     * @tparam Value type of stored value
+     * @tparam N number of elements which fit without heap allocation
+     * @tparam Allocator type of allocator used for heap allocations
+     * @tparam GrowthPolicy policy deciding on the capacity of the heap-allocated arrays
+     */
+    template<typename Value, size_t N, typename Allocator = std::allocator<Value>,
+             typename GrowthPolicy = DefaultGrowthPolicy>
+    class SmallVector : public Vector<Value, detail::SmallBufferAllocator<Value, N, Allocator>,
+                                 detail::SmallBufferGrowthPolicy<GrowthPolicy, N>> {
+        static_assert(N > 0, "Inline capacity should be positive");
+
+        typedef Vector<Value, detail::SmallBufferAllocator<Value, N, Allocator>,
+                       detail::SmallBufferGrowthPolicy<GrowthPolicy, N>>
+                Base;
+
+    protected:
+        /**
+         * @brief Takes the elements of the other vector leaving it empty
+         * @param other vector whose elements get taken
+         *
+         * @note this vector should be empty and use its inline buffer
+         */
+        void takeElements(SmallVector& other) {
+            if (other.isSmall() || other.allocator().heapAllocator() != this->allocator().heapAllocator()) {
+                // elements cannot be stolen so they get relocated
+                this->reserve(other.size_);
+                relocation::relocate(this->allocator(), other.array_, other.size_, this->array_);
+                this->size_ = std::exchange(other.size_, 0);
+            } else {
+                // release the inline buffer and steal the heap array
+                this->releaseArray();
+                other.invalidateIterators();
+                this->array_ = std::exchange(other.array_, other.allocator().allocate(N));
+                this->size_ = std::exchange(other.size_, 0);
+                this->capacity_ = std::exchange(other.capacity_, N);
+            }
+        }
+
+        /**
+         * @brief Destroys all elements and switches back to the inline buffer
+         */
+        void reset() noexcept(std::is_nothrow_destructible<Value>::value) {
+            this->clear();
+            if (!isSmall()) {
+                this->releaseArray();
+                this->array_ = this->allocator().allocate(N);
+                this->capacity_ = N;
+            }
+        }
+
+    public:
+        /* ********************************************** Constructors ********************************************** */
+
+        /**
+         * @brief Creates a new empty vector using its inline buffer
+         */
+        SmallVector() : Base() { this->reserve(N); }
+
+        /**
+         * @brief Copy-constructs a vector from the specified one.
+         * @param original vector whose contents should be {@bold copied} into this one
+         */
+        SmallVector(SmallVector const& original) : SmallVector() {
+            this->reserve(original.size_);
+            this->copyArrayNoChecks(original.array_, original.size_);
+        }
+
+        /**
+         * @brief Move-constructs a vector from the specified one.
+         * @param original vector whose contents should be {@bold moved} into this one
+         *
+         * @note inline elements cannot be stolen so they get relocated one by one
+         */
+        SmallVector(SmallVector&& original) : SmallVector() { takeElements(original); }
+
+        /* ****************************************** Assignment operators ****************************************** */
+
+        SmallVector& operator=(SmallVector const& other) {
+            if (this != &other) {
+                this->clear();
+                this->reserve(other.size_);
+                this->copyArrayNoChecks(other.array_, other.size_);
+            }
+
+            return *this;
+        }
+
+        SmallVector& operator=(SmallVector&& other) {
+            if (this != &other) {
+                reset();
+                takeElements(other);
+            }
+
+            return *this;
+        }
+
+        void swap(SmallVector& other) {
+            SmallVector temporary(std::move(other));
+            other = std::move(*this);
+            *this = std::move(temporary);
+        }
+
+        /* ********************************************* Data accessors ********************************************* */
+
+        /**
+         * @brief Tells whether the elements are stored in the inline buffer.
+         */
+        bool isSmall() const noexcept { return this->allocator().isInline(this->array_); }
+
+        static constexpr size_t inlineCapacity() noexcept { return N; }
+    };
+} // namespace collection
+
+#endif //INCLUDE_SMALL_VECTOR_H_
@@ -0,0 +1,490 @@
+#ifndef INCLUDE_SOA_VECTOR_H_
+#define INCLUDE_SOA_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <growth_policy.h>
+#include <index_iterator.h>
+#include <vector.h>
+#include <vector_ref.h>
+
+namespace collection {
+
+    namespace detail {
+
+        template<typename... Values>
+        struct AllNothrowMoveAssignable : std::true_type {};
+
+        template<typename Value, typename... Values>
+        struct AllNothrowMoveAssignable<Value, Values...>
+            : std::integral_constant<bool, std::is_nothrow_move_assignable<Value>::value
+                                                   && AllNothrowMoveAssignable<Values...>::value> {};
+
+        template<typename... Columns>
+        struct AllNothrowSwappable : std::true_type {};
+
+        template<typename Column, typename... Columns>
+        struct AllNothrowSwappable<Column, Columns...>
+            : std::integral_constant<bool, noexcept(std::declval<Column&>().swap(std::declval<Column&>()))
+                                                   && AllNothrowSwappable<Columns...>::value> {};
+    } // namespace detail
+
+    /**
+     * @brief Vector of records stored as a structure of arrays, i.e. each field of the records is kept
+     * in its own contiguous array so that loops touching a single field do not waste the cache on the others
+     *
+     * All columns grow together by a single decision of the growth policy made for the whole record.
+     * Records are accessed through tuples of references and each column may be accessed as a plain array.
+     *
+     * @tparam GrowthPolicy policy deciding on the capacity of the columns
+     * @tparam Allocator type of allocator which gets rebound for each of the columns
+     * @tparam Fields types of the fields of the records
+     *
+     * @note {@link SoAVector} should be used if the defaults for the policy and the allocator are fine
+     */
+    template<typename GrowthPolicy, typename Allocator, typename... Fields>
+    class BasicSoAVector {
+        static_assert(sizeof...(Fields) > 0, "There should be at least one field");
+
+    public:
+        typedef std::tuple<Fields...> ValueType;
+        typedef ValueType value_type;
+        typedef std::tuple<Fields&...> reference;
+        typedef std::tuple<Fields const&...> ConstReference;
+        typedef GrowthPolicy GrowthPolicyType;
+
+        static constexpr size_t FIELD_COUNT = sizeof...(Fields);
+
+        /**
+         * @brief Type of the field at the given index
+         */
+        template<size_t Index>
+        using Field = typename std::tuple_element<Index, ValueType>::type;
+
+        /**
+         * @brief Type of the vector storing the field of the given type
+         */
+        template<typename Value>
+        using ColumnOf = Vector<Value, typename std::allocator_traits<Allocator>::template rebind_alloc<Value>>;
+
+        /**
+         * @brief Type of the vector storing the field at the given index
+         */
+        template<size_t Index>
+        using Column = ColumnOf<Field<Index>>;
+
+    protected:
+        typedef std::make_index_sequence<FIELD_COUNT> FieldIndices;
+
+        template<size_t Index>
+        using FieldIndex = std::integral_constant<size_t, Index>;
+
+        /**
+         * @brief Calculates the size of the whole record (without padding) as seen by the growth policy
+         */
+        static constexpr size_t recordSize() noexcept {
+            size_t const sizes[] = {sizeof(Fields)...};
+            size_t sum = 0;
+            for (auto const size : sizes) sum += size;
+
+            return sum;
+        }
+
+        static constexpr size_t RECORD_SIZE = recordSize();
+
+        // the columns use the default policy which fits the requested capacities exactly
+        // so that all of them always get the capacity decided by this vector's policy
+        std::tuple<ColumnOf<Fields>...> columns_;
+
+    public:
+        /**
+         * @brief Random access iterator over the records yielding tuples of references to their fields
+         *
+         * @note the iterator is a proxy so the algorithms swapping the pointed values (e.g. sorting) do not work
+         */
+        typedef detail::IndexIterator<BasicSoAVector, reference, void> Iterator;
+        typedef detail::IndexIterator<BasicSoAVector const, ConstReference, void> ConstIterator;
+
+    protected:
+        /* ********************************************* Column helpers ********************************************* */
+
+        template<typename Operation, size_t... Indices>
+        void forEachColumn(Operation&& operation, std::index_sequence<Indices...>) {
+            using Expander = int[];
+            static_cast<void>(Expander{0, (static_cast<void>(operation(std::get<Indices>(columns_))), 0)...});
+        }
+
+        template<typename Operation>
+        void forEachColumn(Operation&& operation) {
+            forEachColumn(operation, FieldIndices{});
+        }
+
+        template<size_t... Indices>
+        reference recordAt(size_t const index, std::index_sequence<Indices...>) {
+            return reference(std::get<Indices>(columns_)[index]...);
+        }
+
+        template<size_t... Indices>
+        ConstReference recordAt(size_t const index, std::index_sequence<Indices...>) const {
+            return ConstReference(std::get<Indices>(columns_)[index]...);
+        }
+
+        template<typename, typename, typename>
+        friend class detail::IndexIterator;
+
+        reference elementAt(size_t const index) { return recordAt(index, FieldIndices{}); }
+
+        ConstReference elementAt(size_t const index) const { return recordAt(index, FieldIndices{}); }
+
+        template<size_t... Indices>
+        size_t minCapacity(std::index_sequence<Indices...>) const noexcept {
+            return std::min({std::get<Indices>(columns_).capacity()...});
+        }
+
+        /**
+         * @brief Moves the record into the other position of the same vector
+         * @param to index of the record which gets overwritten
+         * @param from index of the record which gets moved
+         */
+        void moveRecord(size_t const to, size_t const from) noexcept {
+            forEachColumn([to, from](auto& column) { column[to] = std::move(column[from]); });
+        }
+
+        void truncate(size_t const newSize) noexcept {
+            forEachColumn([newSize](auto& column) { column.erase(column.cbegin() + newSize, column.cend()); });
+        }
+
+        /**
+         * @brief Makes sure that all columns can hold the given number of records without reallocation
+         * @param requiredSize required number of records
+         */
+        void ensureCapacity(size_t const requiredSize) {
+            auto const currentCapacity = capacity();
+            if (requiredSize > currentCapacity) {
+                reserveExactly(GrowthPolicy::grow(currentCapacity, requiredSize, RECORD_SIZE));
+            }
+        }
+
+        void reserveExactly(size_t const newCapacity) {
+            forEachColumn([newCapacity](auto& column) { column.reserve(newCapacity); });
+        }
+
+        /**
+         * @brief Appends the fields to their columns removing the already appended ones if any of them throws
+         */
+        template<size_t Index, typename Argument, typename... Arguments>
+        void appendFields(FieldIndex<Index>, Argument&& argument, Arguments&&... arguments) {
+            auto& column = std::get<Index>(columns_);
+            column.emplaceBack(std::forward<Argument>(argument));
+            try {
+                appendFields(FieldIndex<Index + 1>{}, std::forward<Arguments>(arguments)...);
+            } catch (...) {
+                column.popBack();
+                throw;
+            }
+        }
+
+        void appendFields(FieldIndex<FIELD_COUNT>) noexcept {}
+
+        template<typename Record, size_t... Indices>
+        void appendRecord(Record&& record, std::index_sequence<Indices...>) {
+            emplaceBack(std::get<Indices>(std::forward<Record>(record))...);
+        }
+
+        /**
+         * @brief Resizes the columns starting at the given one shrinking the already resized ones back on failure
+         */
+        template<size_t Index>
+        void growColumns(FieldIndex<Index>, size_t const oldSize, size_t const newSize) {
+            auto& column = std::get<Index>(columns_);
+            column.resize(newSize);
+            try {
+                growColumns(FieldIndex<Index + 1>{}, oldSize, newSize);
+            } catch (...) {
+                column.erase(column.cbegin() + oldSize, column.cend());
+                throw;
+            }
+        }
+
+        void growColumns(FieldIndex<FIELD_COUNT>, size_t, size_t) noexcept {}
+
+        inline void checkRange(size_t const index) const {
+            if (index >= size()) detail::throwOutOfRange(index, size());
+        }
+
+        inline void checkNotEmpty() const {
+            if (empty()) detail::throwOutOfRangeEmpty();
+        }
+
+    public:
+        /* ********************************************** Constructors ********************************************** */
+
+        BasicSoAVector() = default;
+
+        /**
+         * @brief Creates a new empty vector using the given allocator.
+         * @param allocator allocator rebound for each of the columns
+         */
+        explicit BasicSoAVector(Allocator const& allocator)
+            : columns_(ColumnOf<Fields>(typename ColumnOf<Fields>::AllocatorType(allocator))...) {}
+
+        /**
+         * @brief Creates a vector containing copies of the given records.
+         * @param records records which should be {@bold copied} into this vector
+         */
+        BasicSoAVector(std::initializer_list<ValueType> const records) {
+            reserve(records.size());
+            for (auto const& record : records) pushBack(record);
+        }
+
+        BasicSoAVector(BasicSoAVector const&) = default;
+
+        BasicSoAVector(BasicSoAVector&&) noexcept = default;
+
+        /**
+         * @brief Copy-assigns the records of the other vector either fully or not at all.
+         * @param other vector whose records should be {@bold copied} into this one
+         */
+        BasicSoAVector& operator=(BasicSoAVector const& other) {
+            if (this != &other) {
+                BasicSoAVector copy(other);
+                swap(copy);
+            }
+
+            return *this;
+        }
+
+        BasicSoAVector& operator=(BasicSoAVector&&) = default;
+
+        /**
+         * @brief Swaps the records of this vector with the ones of the other vector.
+         * @param other vector whose records are swapped with the ones of this vector
+         *
+         * @note if the columns' allocators do not allow exchanging the arrays, the records get moved
+         * and if a move throws, both vectors get cleared so that their columns stay consistent
+         */
+        void swap(BasicSoAVector& other) noexcept(NothrowSwappable::value) {
+            swapColumns(other, NothrowSwappable{});
+        }
+
+    protected:
+        typedef detail::AllNothrowSwappable<ColumnOf<Fields>...> NothrowSwappable;
+
+        template<size_t... Indices>
+        void swapColumns(BasicSoAVector& other, std::index_sequence<Indices...>) {
+            using Expander = int[];
+            static_cast<void>(Expander{0, (std::get<Indices>(columns_).swap(std::get<Indices>(other.columns_)), 0)...});
+        }
+
+        void swapColumns(BasicSoAVector& other, std::true_type /* nothrow */) noexcept {
+            swapColumns(other, FieldIndices{});
+        }
+
+        void swapColumns(BasicSoAVector& other, std::false_type /* nothrow */) {
+            try {
+                swapColumns(other, FieldIndices{});
+            } catch (...) {
+                clear();
+                other.clear();
+                throw;
+            }
+        }
+
+    public:
+        /* ********************************************* Indexed access ********************************************* */
+
+        /**
+         * @brief Gets the record at the given index.
+         * @param index index of the record
+         * @return tuple of references to the record's fields
+         */
+        reference operator[](size_t const index) { return recordAt(index, FieldIndices{}); }
+
+        ConstReference operator[](size_t const index) const { return recordAt(index, FieldIndices{}); }
+
+        reference at(size_t const index) {
+            checkRange(index);
+
+            return recordAt(index, FieldIndices{});
+        }
+
+        ConstReference at(size_t const index) const {
+            checkRange(index);
+
+            return recordAt(index, FieldIndices{});
+        }
+
+        /**
+         * @brief Gets the field of the record at the given index.
+         * @tparam Index index of the field
+         * @param index index of the record
+         * @return reference to the field
+         */
+        template<size_t Index>
+        Field<Index>& get(size_t const index) { return std::get<Index>(columns_)[index]; }
+
+        template<size_t Index>
+        Field<Index> const& get(size_t const index) const { return std::get<Index>(columns_)[index]; }
+
+        /**
+         * @brief Gets the array holding the given field of all records, suitable for vectorized scans.
+         * @tparam Index index of the field
+         * @return reference to the contiguous array of the fields which is valid until the next reallocation
+         */
+        template<size_t Index>
+        VectorRef<Field<Index>> column() { return std::get<Index>(columns_); }
+
+        template<size_t Index>
+        VectorRef<Field<Index> const> column() const { return std::get<Index>(columns_); }
+
+        /* *********************************************** Iterators ************************************************ */
+
+        Iterator begin() noexcept { return Iterator(this, 0); }
+
+        Iterator end() noexcept { return Iterator(this, size()); }
+
+        ConstIterator begin() const noexcept { return ConstIterator(this, 0); }
+
+        ConstIterator end() const noexcept { return ConstIterator(this, size()); }
+
+        ConstIterator cbegin() const noexcept { return begin(); }
+
+        ConstIterator cend() const noexcept { return end(); }
+
+        /* ********************************************* Data accessors ********************************************* */
+
+        bool empty() const noexcept { return size() == 0; }
+
+        size_t size() const noexcept { return std::get<0>(columns_).size(); }
+
+        /**
+         * @brief Gets the number of records which fit into all of the columns without reallocation.
+         */
+        size_t capacity() const noexcept { return minCapacity(FieldIndices{}); }
+
+        /* *********************************************** Modifiers ************************************************ */
+
+        void reserve(size_t const newCapacity) {
+            if (capacity() < newCapacity) reserveExactly(GrowthPolicy::fit(newCapacity, RECORD_SIZE));
+        }
+
+        /**
+         * @brief Appends a new record constructing each of its fields from the corresponding argument.
+         * @param arguments arguments forwarded to the constructors of the fields, one per field
+         *
+         * @note if any of the fields cannot be constructed, the vector is left unchanged
+         */
+        template<typename... Arguments>
+        void emplaceBack(Arguments&&... arguments) {
+            static_assert(sizeof...(Arguments) == FIELD_COUNT, "There should be exactly one argument per field");
+
+            ensureCapacity(size() + 1);
+            appendFields(FieldIndex<0>{}, std::forward<Arguments>(arguments)...);
+        }
+
+        void pushBack(ValueType const& record) { appendRecord(record, FieldIndices{}); }
+
+        void pushBack(ValueType&& record) { appendRecord(std::move(record), FieldIndices{}); }
+
+        void popBack() {
+#if COLLECTION_VECTOR_CHECKS >= 1
+            checkNotEmpty();
+#endif
+
+            forEachColumn([](auto& column) { column.popBack(); });
+        }
+
+        /**
+         * @brief Resizes this vector value-initializing the new records.
+         * @param newSize new number of records
+         *
+         * @note if any of the fields cannot be constructed, the vector is left unchanged
+         */
+        void resize(size_t const newSize) {
+            auto const currentSize = size();
+            if (newSize < currentSize) truncate(newSize);
+            else if (newSize > currentSize) {
+                ensureCapacity(newSize);
+                growColumns(FieldIndex<0>{}, currentSize, newSize);
+            }
+        }
+
+        void clear() noexcept { truncate(0); }
+
+        /**
+         * @brief Erases the record in constant time by moving the last record into its place
+         * so that the order of the records is not preserved
+         * @param index index of the erased record
+         */
+        void swapErase(size_t const index) {
+            static_assert(detail::AllNothrowMoveAssignable<Fields...>::value,
+                          "Fields should be nothrow move-assignable so that the columns stay consistent");
+
+            checkRange(index);
+            auto const last = size() - 1;
+            if (index != last) moveRecord(index, last);
+            truncate(last);
+        }
+
+        /**
+         * @brief Erases all records satisfying the predicate in a single pass preserving the order of the rest
+         * @param predicate predicate called once with the {@link ConstReference} to each record
+         * @return number of erased records
+         *
+         * @note if the predicate throws, only the records which it has already accepted get erased
+         */
+        template<typename Predicate>
+        size_t eraseIf(Predicate predicate) {
+            static_assert(detail::AllNothrowMoveAssignable<Fields...>::value,
+                          "Fields should be nothrow move-assignable so that the columns stay consistent");
+
+            auto const currentSize = size();
+            size_t kept = 0, index = 0;
+            try {
+                for (; index < currentSize; ++index) {
+                    if (predicate(static_cast<BasicSoAVector const&>(*this)[index])) continue;
+                    if (kept != index) moveRecord(kept, index);
+                    ++kept;
+                }
+            } catch (...) {
+                for (; index < currentSize; ++index, ++kept) if (kept != index) moveRecord(kept, index);
+                truncate(kept);
+                throw;
+            }
+            truncate(kept);
+
+            return currentSize - kept;
+        }
+
+        /**
+         * @brief Releases the unused capacity of all columns.
+         */
+        void shrinkToFit() {
+            forEachColumn([](auto& column) { column.shrinkToFit(); });
+        }
+    };
+
+    template<typename GrowthPolicy, typename Allocator, typename... Fields>
+    constexpr size_t BasicSoAVector<GrowthPolicy, Allocator, Fields...>::FIELD_COUNT;
+
+    template<typename GrowthPolicy, typename Allocator, typename... Fields>
+    constexpr size_t BasicSoAVector<GrowthPolicy, Allocator, Fields...>::RECORD_SIZE;
+
+    /**
+     * @brief Structure-of-arrays vector using the default growth policy and {@code std::allocator}
+     * @tparam Fields types of the fields of the records
+     */
+    template<typename... Fields>
+    using SoAVector = BasicSoAVector<DefaultGrowthPolicy, std::allocator<void>, Fields...>;
+} // namespace collection
+
+#endif //INCLUDE_SOA_VECTOR_H_
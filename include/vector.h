@@ -2,109 +2,554 @@
 #define INCLUDE_VECTOR_H_
 
 #include <algorithm>
+#include <cstring>
+#include <initializer_list>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <utility>
 
+#include <allocator_extensions.h>
+#include <checks.h>
+#include <growth_policy.h>
+#include <parallel.h>
+#include <relocation.h>
+#include <simd.h>
+
+#if defined(COLLECTION_VECTOR_STATS)
+#include <vector_stats.h>
+#endif
+
 namespace collection {
 
+    namespace detail {
+
+        /**
+         * @brief Holder of the allocator which takes no space if the allocator is empty
+         * @tparam Allocator type of the held allocator
+         */
+        template<typename Allocator, bool = std::is_empty<Allocator>::value && !std::is_final<Allocator>::value>
+        class AllocatorHolder : private Allocator {
+        protected:
+            AllocatorHolder() = default;
+
+            explicit AllocatorHolder(Allocator const& allocator) : Allocator(allocator) {}
+
+            explicit AllocatorHolder(Allocator&& allocator) : Allocator(std::move(allocator)) {}
+
+            Allocator& allocator() noexcept { return *this; }
+
+            Allocator const& allocator() const noexcept { return *this; }
+        };
+
+        template<typename Allocator>
+        class AllocatorHolder<Allocator, false> {
+            Allocator allocator_;
+
+        protected:
+            AllocatorHolder() = default;
+
+            explicit AllocatorHolder(Allocator const& allocator) : allocator_(allocator) {}
+
+            explicit AllocatorHolder(Allocator&& allocator) : allocator_(std::move(allocator)) {}
+
+            Allocator& allocator() noexcept { return allocator_; }
+
+            Allocator const& allocator() const noexcept { return allocator_; }
+        };
+    } // namespace detail
+
+    /**
+     * @brief Tag requesting default-initialization (i.e. no initialization for trivial types) of new elements
+     */
+    struct DefaultInitTag {
+        explicit constexpr DefaultInitTag() = default;
+    };
+
+    constexpr DefaultInitTag default_init{};
+
     /**
      * @brief Vector of elements
      * @tparam Value type of stored value
      * @tparam Allocator type of used allocator
+     * @tparam GrowthPolicy policy deciding on the capacity of the allocated arrays
+     * @tparam SizeType unsigned type used to store the size and the capacity
+     *
+     * @note stateless allocators take no space;
+     * the checks of the arguments and of the iterators are selected by {@code COLLECTION_VECTOR_CHECKS}
      */
-    template<typename Value, typename Allocator = std::allocator<Value>>
-    class Vector {
+    template<typename Value, typename Allocator = std::allocator<Value>, typename GrowthPolicy = DefaultGrowthPolicy,
+             typename SizeType = size_t>
+    class Vector : protected detail::AllocatorHolder<Allocator> {
+        static_assert(std::is_unsigned<SizeType>::value, "Size type should be unsigned");
+
+        typedef detail::AllocatorHolder<Allocator> AllocatorHolder;
+
+    protected:
+        using AllocatorHolder::allocator;
+
     public:
         typedef Value ValueType;
+        typedef Value value_type;
         typedef Value& reference;
         typedef Value const& ConstReference;
         typedef Value&& RValueReference;
         typedef Value* Pointer;
-        typedef const Pointer ConstPointer;
+        typedef Value const* ConstPointer;
+#if COLLECTION_VECTOR_CHECKS >= 2
+        typedef detail::CheckedIterator<Value, Vector> Iterator;
+        typedef detail::CheckedIterator<Value const, Vector> ConstIterator;
+#else
         typedef Pointer Iterator;
         typedef ConstPointer ConstIterator;
+#endif
         typedef Allocator AllocatorType;
         typedef std::allocator_traits<AllocatorType> Memory;
+        typedef AllocatorExtensions<AllocatorType> Extensions;
+        typedef GrowthPolicy GrowthPolicyType;
+
+        /**
+         * @brief Tells how the elements get relocated on reallocation so that it may be asserted at compile time
+         */
+        typedef collection::relocation_kind<ValueType> relocation_kind;
 
     protected:
-        static constexpr size_t DEFAULT_CAPACITY = 16;
+        /**
+         * @brief Tells whether the elements may be moved by the allocator's {@code reallocate} (bytewise)
+         */
+        typedef std::integral_constant<bool, Extensions::canReallocate && is_trivially_relocatable<Value>::value>
+                Reallocatable;
+
+        /**
+         * @brief Tells whether the elements may be shifted in place by relocation, otherwise they get move-assigned
+         */
+        typedef relocation::Shiftable<ValueType> Shiftable;
 
-        AllocatorType allocator_;
         Pointer array_;
-        size_t size_, capacity_;
+        SizeType size_, capacity_;
+#if COLLECTION_VECTOR_CHECKS >= 2
+        template<typename, typename>
+        friend class detail::CheckedIterator;
+
+        /**
+         * @brief Number of times the array has been replaced or released which is remembered by the iterators
+         * so that they get invalidated even if the new array happens to be allocated at the same address
+         */
+        size_t generation_ = 0;
+#endif
 
     protected:
+        /* ******************************************* Bulk construction ******************************************** */
+
+        /**
+         * @brief Tells whether copies of the elements pointed by the iterator may be created by a plain byte copy
+         */
+        template<typename SourceIterator>
+        using BitwiseCopyable = std::integral_constant<
+                bool, std::is_pointer<SourceIterator>::value && std::is_trivially_copyable<ValueType>::value
+                              && uses_default_construct<AllocatorType>::value
+                              && std::is_same<typename std::remove_cv<
+                                                      typename std::remove_pointer<SourceIterator>::type>::type,
+                                              ValueType>::value>;
+
+        template<typename ForwardIterator>
+        void constructCopies(Pointer const target, ForwardIterator const first, size_t const count,
+                             std::true_type /* bitwise */) noexcept {
+            if (count != 0) {
+                std::memcpy(static_cast<void*>(target), static_cast<void const*>(first), count * sizeof(Value));
+            }
+        }
+
+        template<typename ForwardIterator>
+        void constructCopies(Pointer const target, ForwardIterator first, size_t const count,
+                             std::false_type /* bitwise */) {
+            size_t constructed = 0;
+            try {
+                for (; constructed < count; ++constructed, ++first) {
+                    Memory::construct(allocator(), target + constructed, *first);
+                }
+            } catch (...) {
+                for (size_t i = 0; i < constructed; ++i) Memory::destroy(allocator(), target + i);
+                throw;
+            }
+        }
+
+        /**
+         * @brief Constructs copies of the elements of the range in uninitialized memory
+         * @param target uninitialized memory fitting {@code count} elements
+         * @param first iterator pointing to the first copied element
+         * @param count number of copied elements
+         *
+         * @note either all or none of the elements get constructed
+         */
+        template<typename ForwardIterator>
+        void constructCopies(Pointer const target, ForwardIterator const first, size_t const count) {
+            constructCopies(target, first, count, BitwiseCopyable<ForwardIterator>{});
+        }
+
+        /**
+         * @brief Tells whether copies of the elements may be created by a plain byte copy
+         */
+        typedef std::integral_constant<bool, std::is_trivially_copyable<ValueType>::value
+                                                     && uses_default_construct<AllocatorType>::value>
+                BitwiseFillable;
+
+        void constructFill(Pointer const target, size_t const count, ConstReference value,
+                           std::true_type /* bitwise */) noexcept {
+            simd::fill(target, count, value);
+        }
+
+        void constructFill(Pointer const target, size_t const count, ConstReference value,
+                           std::false_type /* bitwise */) {
+            size_t constructed = 0;
+            try {
+                for (; constructed < count; ++constructed) Memory::construct(allocator(), target + constructed, value);
+            } catch (...) {
+                for (size_t i = 0; i < constructed; ++i) Memory::destroy(allocator(), target + i);
+                throw;
+            }
+        }
+
+        /**
+         * @brief Constructs copies of the value in uninitialized memory
+         * @param target uninitialized memory fitting {@code count} elements
+         * @param count number of copies
+         * @param value value to be copied, it should not be located in the target memory
+         *
+         * @note either all or none of the elements get constructed
+         */
+        void constructFill(Pointer const target, size_t const count, ConstReference value) {
+            constructFill(target, count, value, BitwiseFillable{});
+        }
+
+        void fill(ConstReference value, std::true_type /* bitwise */) noexcept { simd::fill(array_, size_, value); }
+
+        void fill(ConstReference value, std::false_type /* bitwise */) { std::fill(array_, array_ + size_, value); }
+
         /* ************************************************* Checks ************************************************* */
 
-        inline void copyArrayNoChecks(ConstPointer originalArray, size_t const size) const {
-            for (size_t i = 0; i < size; ++i) Memory::construct(allocator_, array_ + i, *(originalArray + i));
+        /**
+         * @brief Appends copies of the given elements without checking the capacity
+         * @param originalArray elements to be copied
+         * @param size number of elements to be copied
+         *
+         * @note the size gets updated per element so that only the constructed ones get destroyed on exception
+         */
+        inline void copyArrayNoChecks(ConstPointer originalArray, size_t const size) {
+            constructCopies(array_ + size_, originalArray, size);
+            size_ += size;
         }
 
-        inline void throwOutOfRange(size_t const index) const {
-            throw std::out_of_range("Index " + std::to_string(index) + " should be < size " + std::to_string(size_));
+        /**
+         * @brief Appends copies of the given elements without checking the capacity splitting the work across threads
+         * @param originalArray elements to be copied
+         * @param size number of elements to be copied
+         *
+         * @note either all or none of the elements get copied
+         */
+        void copyArrayNoChecks(ConstPointer const originalArray, size_t const size, ParallelTag) {
+            auto const target = array_ + size_;
+            parallel::forEachChunk(
+                    size,
+                    [this, target, originalArray](size_t const first, size_t const count) {
+                        constructCopies(target + first, originalArray + first, count);
+                    },
+                    [this, target](size_t const first, size_t const count) noexcept {
+                        destroyElements(target + first, count);
+                    });
+            size_ += size;
         }
 
-        inline void throwOutOfRangeEmpty() const { throw std::out_of_range("Vector is empty"); }
+        /**
+         * @brief Replaces the array by the new one destroying the current elements instead of relocating them
+         * @param newArray array allocated by this vector's allocator
+         * @param newCapacity capacity of the new array
+         */
+        void adoptArray(Pointer const newArray, size_t const newCapacity) {
+            clear();
+            releaseArray();
+            recordGrowth(newCapacity, false);
+            array_ = newArray;
+            capacity_ = newCapacity;
+        }
+
+        void assignArray(ConstPointer const originalArray, size_t const size, std::true_type /* bitwise */) {
+            if (size > capacity_) {
+                auto const newCapacity = fittingCapacity(size);
+                adoptArray(Memory::allocate(allocator(), newCapacity), newCapacity);
+            }
+            // the current elements need no destruction so they simply get overwritten
+            constructCopies(array_, originalArray, size, std::true_type{});
+            size_ = size;
+        }
+
+        void assignArray(ConstPointer const originalArray, size_t const size, std::false_type /* bitwise */) {
+            if (size > capacity_) {
+                auto const newCapacity = fittingCapacity(size);
+                Pointer const newArray = Memory::allocate(allocator(), newCapacity);
+                try {
+                    constructCopies(newArray, originalArray, size, std::false_type{});
+                } catch (...) {
+                    Memory::deallocate(allocator(), newArray, newCapacity);
+                    throw;
+                }
+                adoptArray(newArray, newCapacity);
+                size_ = size;
+
+                return;
+            }
+
+            auto const assigned = std::min(static_cast<size_t>(size_), size);
+            std::copy(originalArray, originalArray + assigned, array_);
+            if (size > assigned) copyArrayNoChecks(originalArray + assigned, size - assigned);
+            else {
+                destroyElements(array_ + size, size_ - size);
+                size_ = size;
+            }
+        }
+
+        /**
+         * @brief Replaces the elements by copies of the given ones reusing the array if it fits them
+         * @param originalArray elements to be copied, they should not belong to this vector
+         * @param size number of elements to be copied
+         *
+         * @note the live elements get copy-assigned, only the missing ones get constructed and the surplus destroyed,
+         * trivially copyable elements are copied as raw bytes
+         */
+        void assignArray(ConstPointer const originalArray, size_t const size) {
+            assignArray(originalArray, size, BitwiseCopyable<ConstPointer>{});
+        }
+
+        void destroyElements(Pointer const first, size_t const count) noexcept {
+            for (size_t i = 0; i < count; ++i) Memory::destroy(allocator(), first + i);
+        }
+
+        /**
+         * @brief Destroys the elements splitting the work across threads
+         * @param first first destroyed element
+         * @param count number of destroyed elements
+         */
+        void destroyElements(Pointer const first, size_t const count, ParallelTag) noexcept {
+            // allocators constructing by placement-new are expected to destroy by plain destructor calls
+            if (std::is_trivially_destructible<ValueType>::value && uses_default_construct<AllocatorType>::value) {
+                return;
+            }
+
+            parallel::forEachChunk(count, [this, first](size_t const offset, size_t const chunkSize) noexcept {
+                destroyElements(first + offset, chunkSize);
+            });
+        }
 
         inline void checkRange(size_t const index) const {
-            if (index >= size_) throwOutOfRange(index);
+            if (index >= size_) detail::throwOutOfRange(index, size_);
         }
 
         inline void checkNotEmpty() const {
-            if (size_ == 0) throwOutOfRangeEmpty();
+            if (size_ == 0) detail::throwOutOfRangeEmpty();
+        }
+
+        static void checkLength(size_t const requiredSize) {
+            if (requiredSize > maxSize()) detail::throwLengthError(requiredSize);
+        }
+
+        /**
+         * @brief Checks the index passed to the unchecked accessors if {@code COLLECTION_VECTOR_CHECKS} is at least 2
+         * @param index index of the accessed element
+         */
+        inline void checkAccess(size_t const index) const {
+#if COLLECTION_VECTOR_CHECKS >= 2
+            checkRange(index);
+#else
+            static_cast<void>(index);
+#endif
         }
 
+        /**
+         * @brief Gets the position of the iterator as an index checking that it lies within the elements
+         * or at their end if {@code COLLECTION_VECTOR_CHECKS} is at least 1
+         * @param position checked position
+         * @return index of the position
+         */
+        size_t checkedIndex(ConstIterator const position) const {
+            auto const pointer = pointerOf(position);
+#if COLLECTION_VECTOR_CHECKS >= 1
+            if (pointer < array_) detail::throwRangeError("`position` is out of lower bound");
+            if (pointer > array_ + size_) detail::throwRangeError("`position` is out of higher bound");
+#endif
+
+            return static_cast<size_t>(pointer - array_);
+        }
+
+        /* *********************************************** Iterators ************************************************ */
+
+#if COLLECTION_VECTOR_CHECKS >= 2
+        Iterator iteratorTo(Pointer const pointer) noexcept { return Iterator(this, pointer); }
+
+        ConstIterator iteratorTo(ConstPointer const pointer) const noexcept { return ConstIterator(this, pointer); }
+
+        /**
+         * @brief Gets the pointer to the element pointed by the iterator checking that it is valid for this vector
+         */
+        ConstPointer pointerOf(ConstIterator const iterator) const { return iterator.pointerIn(this); }
+#else
+        static constexpr Iterator iteratorTo(Pointer const pointer) noexcept { return pointer; }
+
+        static constexpr ConstIterator iteratorTo(ConstPointer const pointer) noexcept { return pointer; }
+
+        static constexpr ConstPointer pointerOf(ConstIterator const iterator) noexcept { return iterator; }
+#endif
+
+        /* ******************************************** Instrumentation ********************************************* */
+
+#if defined(COLLECTION_VECTOR_STATS)
+        static stats::Counters& counters() { return stats::countersOf<Vector>(); }
+
+        /**
+         * @brief Records the growth of the array to the given capacity
+         * @param newCapacity capacity of the array after the growth
+         * @param inPlace whether the array has grown without relocation of the elements
+         */
+        void recordGrowth(size_t const newCapacity, bool const inPlace) const {
+            stats::recordGrowth(counters(), newCapacity * sizeof(ValueType), inPlace ? 0 : size_ * sizeof(ValueType),
+                                inPlace);
+        }
+
+        void recordShrink(size_t const newCapacity) const {
+            stats::recordShrink(counters(), newCapacity == 0 ? 0 : size_ * sizeof(ValueType));
+        }
+
+        void recordDestruction() const {
+            if (capacity_ != 0) {
+                stats::recordDestruction(counters(), capacity_ * sizeof(ValueType), size_ * sizeof(ValueType));
+            }
+        }
+#else
+        // the instrumentation is disabled so these get optimized out entirely
+
+        void recordGrowth(size_t, bool) const noexcept {}
+
+        void recordShrink(size_t) const noexcept {}
+
+        void recordDestruction() const noexcept {}
+#endif
+
         /* ************************************************ Resizers ************************************************ */
 
-        void resizeToBigger(size_t const newCapacity) {
+        /**
+         * @brief Invalidates the iterators as the array gets replaced or released
+         * if {@code COLLECTION_VECTOR_CHECKS} is at least 2
+         */
+        void invalidateIterators() noexcept {
+#if COLLECTION_VECTOR_CHECKS >= 2
+            ++generation_;
+#endif
+        }
+
+        /**
+         * @brief Deallocates the current array (if any) without destroying its elements
+         */
+        void releaseArray() noexcept {
+            invalidateIterators();
+            if (array_ != nullptr) Memory::deallocate(allocator(), array_, capacity_);
+        }
+
+        void reallocateArray(size_t const newCapacity, std::true_type /* reallocatable */) {
+            invalidateIterators();
+            array_ = array_ == nullptr ? Memory::allocate(allocator(), newCapacity)
+                                       : Extensions::reallocate(allocator(), array_, capacity_, newCapacity);
+        }
+
+        void reallocateArray(size_t const newCapacity, std::false_type /* reallocatable */) {
             // allocate new memory segment
-            Pointer const newArray = Memory::allocate(allocator_, newCapacity);
-            // move all currently constructed elements to the new memory location
-
-            { // move values
-                ConstPointer const sourceEnd = array_ + size_;
-                for (Pointer source = array_, target = newArray; source != sourceEnd; ++source) {
-                    Memory::construct(allocator_, target++, std::move(*source));
-                    Memory::destroy(allocator_, source);
-                }
-                Memory::deallocate(allocator_, array_, capacity_);
+            Pointer const newArray = Memory::allocate(allocator(), newCapacity);
+            // relocate all currently constructed elements to the new memory location
+            try {
+                relocation::relocate(allocator(), array_, size_, newArray);
+            } catch (...) {
+                // the elements are left intact so only the new array has to be released
+                Memory::deallocate(allocator(), newArray, newCapacity);
+                throw;
             }
+            releaseArray();
 
             array_ = newArray;
+        }
+
+        void resizeToBigger(size_t const newCapacity) {
+            // try growing in place so that no element has to be relocated
+            auto const inPlace
+                    = array_ != nullptr && Extensions::tryExpand(allocator(), array_, capacity_, newCapacity);
+            if (!inPlace) reallocateArray(newCapacity, Reallocatable{});
+            recordGrowth(newCapacity, inPlace);
+
             capacity_ = newCapacity;
         }
 
         void resizeToSmaller(size_t const newCapacity) {
-            Pointer const newArray = Memory::allocate(allocator_, newCapacity);
-            {
-                // move kept values
-                Pointer source;
-                {
-                    Pointer target;
-                    ConstPointer const moveSourceEnd = array_ + size_;
-                    for (source = array_, target = newArray; source != moveSourceEnd; ++source) {
-                        Memory::construct(allocator_, target++, std::move(source));
-                        Memory::destroy(allocator_, source);
-                    }
-                }
-                ConstPointer const sourceEnd = array_ + capacity_;
-                for (; source != sourceEnd; ++source) Memory::destroy(allocator_, source);
-            }
-            Memory::deallocate(allocator_, array_, capacity_);
+            auto const keptSize = std::min(static_cast<size_t>(size_), newCapacity);
+            // destroy values which do not fit
+            for (size_t i = keptSize; i < size_; ++i) Memory::destroy(allocator(), array_ + i);
+            size_ = keptSize;
+
+            if (newCapacity == 0) {
+                releaseArray();
+                array_ = nullptr;
+            } else reallocateArray(newCapacity, Reallocatable{});
+            recordShrink(newCapacity);
 
-            array_ = newArray;
             capacity_ = newCapacity;
         }
 
-        static constexpr size_t increasedCapacity(size_t const capacity) {
-            return capacity < 2 ? 2 : capacity + (capacity >> 1u);
+        /**
+         * @brief Shrinks the array if the growth policy considers too much of its capacity unused
+         */
+        void shrinkAfterRemoval() {
+            auto const newCapacity = GrowthPolicyTraits<GrowthPolicy>::shrink(size_, capacity_, sizeof(ValueType));
+            if (newCapacity < capacity_) resizeToSmaller(newCapacity);
+        }
+
+        /**
+         * @brief Calculates the capacity to which the array should grow to fit the given number of elements
+         * @param requiredSize number of elements which should fit the array
+         * @return new capacity not less than {@code requiredSize}
+         */
+        size_t grownCapacity(size_t const requiredSize) const {
+            checkLength(requiredSize);
+
+            return std::min(GrowthPolicy::grow(capacity_, requiredSize, sizeof(ValueType)), maxSize());
         }
 
-        void requireExtraSlot() {
+        /**
+         * @brief Calculates the capacity which should be allocated for the explicitly requested number of elements
+         * @param requiredSize number of elements which should fit the array
+         * @return new capacity not less than {@code requiredSize}
+         */
+        static size_t fittingCapacity(size_t const requiredSize) {
+            checkLength(requiredSize);
+
+            return std::min(GrowthPolicy::fit(requiredSize, sizeof(ValueType)), maxSize());
+        }
+
+        /**
+         * @brief Ensures that there is a free slot after the last element without moving the elements
+         * @return {@code true} if there is a free slot and {@code false} if the array has to be reallocated
+         */
+        bool hasExtraSlotInPlace() {
             auto const currentCapacity = capacity_;
-            if (size_ == 0 || size_ == currentCapacity - 1) resizeToBigger(increasedCapacity(currentCapacity));
+            if (size_ != currentCapacity) return true;
+
+            auto const newCapacity = grownCapacity(static_cast<size_t>(currentCapacity) + 1);
+            if (array_ != nullptr && Extensions::tryExpand(allocator(), array_, currentCapacity, newCapacity)) {
+                recordGrowth(newCapacity, true);
+                capacity_ = newCapacity;
+
+                return true;
+            }
+
+            return false;
         }
 
         /* ****************************************** Internal constructor ****************************************** */
@@ -112,12 +557,22 @@ namespace collection {
         // this does not perform object construction
 
         /**
-         * @brief Creates a vector of equal size and capacity without constructing its entries
-         * @param capacity capacity of the create vector, should not be less than {@code
+         * @brief Creates a vector of the given size and capacity without constructing its entries
+         * @param capacity capacity of the create vector, should not be less than {@code size}
          * @param size size of the created vector
+         * @param allocator allocator used by the created vector
          */
-        Vector(size_t capacity, size_t const size)
-            : array_(Memory::allocate(allocator_, capacity)), size_(size), capacity_(capacity) {}
+        Vector(size_t const capacity, size_t const size, AllocatorType const& allocator)
+            : AllocatorHolder(allocator),
+              array_(capacity == 0 ? nullptr : Memory::allocate(this->allocator(), capacity)),
+              size_(size), capacity_(capacity) {}
+
+        /**
+         * @brief Creates a vector of the given size and capacity without constructing its entries
+         * @param capacity capacity of the create vector, should not be less than {@code size}
+         * @param size size of the created vector
+         */
+        Vector(size_t const capacity, size_t const size) : Vector(capacity, size, AllocatorType()) {}
 
         /**
          * @brief Creates a vector of equal size and capacity without constructing its entries
@@ -125,139 +580,524 @@ namespace collection {
          */
         Vector(size_t const size) : Vector(size, size) {}
 
+        /* ******************************************* Allocator handling ******************************************* */
+
+        typedef typename Memory::propagate_on_container_copy_assignment PropagateOnCopyAssignment;
+        typedef typename Memory::propagate_on_container_move_assignment PropagateOnMoveAssignment;
+        typedef typename Memory::propagate_on_container_swap PropagateOnSwap;
+
+        /**
+         * @brief Tells whether the arrays allocated by the allocators of this and the other vector are interchangeable
+         * @param other other vector
+         */
+        bool sharesAllocator(Vector const& other) const noexcept {
+            return std::allocator_traits<AllocatorType>::is_always_equal::value || allocator() == other.allocator();
+        }
+
+        void copyAllocator(Vector const& other, std::true_type /* propagate */) {
+            if (!sharesAllocator(other)) {
+                // the current array cannot be deallocated by the new allocator
+                clear();
+                releaseArray();
+                array_ = nullptr;
+                capacity_ = 0;
+            }
+            allocator() = other.allocator();
+        }
+
+        void copyAllocator(Vector const&, std::false_type /* propagate */) noexcept {}
+
+        void swapAllocators(Vector& other, std::true_type /* propagate */) noexcept {
+            using std::swap;
+            swap(allocator(), other.allocator());
+        }
+
+        void swapAllocators(Vector&, std::false_type /* propagate */) noexcept {}
+
+        /**
+         * @brief Takes the array of the other vector which is known to be deallocatable by this vector's allocator
+         * @param other vector whose array gets taken leaving it empty
+         *
+         * @note this vector should have no array
+         */
+        void stealArray(Vector& other) noexcept {
+            other.invalidateIterators();
+            array_ = std::exchange(other.array_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            capacity_ = std::exchange(other.capacity_, 0);
+        }
+
+        void moveAssign(Vector& other, std::true_type /* propagate */) noexcept {
+            clear();
+            releaseArray();
+            allocator() = std::move(other.allocator());
+            stealArray(other);
+        }
+
+        void moveAssign(Vector& other, std::false_type /* propagate */) {
+            if (sharesAllocator(other)) {
+                clear();
+                releaseArray();
+                stealArray(other);
+            } else {
+                // the array allocated by the other allocator cannot be taken so the elements get moved one by one
+                clear();
+                append(std::make_move_iterator(other.array_), std::make_move_iterator(other.array_ + other.size_));
+                other.clear();
+            }
+        }
+
         /* ************************************* Internal complicated modifiers ************************************* */
 
 
-        void uncheckedInsert(Iterator position, ConstReference value) {
-            // this should happen before reallocation as after the pointers change
-            auto const index = position - array_;
-            requireExtraSlot();
+        /**
+         * @brief Reallocates the array constructing a new element at the given index
+         * @param index index at which the element should be constructed
+         * @param newCapacity capacity of the new array
+         * @param arguments arguments used to construct the element, they may refer to the elements of this vector
+         * @return reference to the constructed element
+         */
+        template<typename... Arguments>
+        reference emplaceReallocating(size_t const index, size_t const newCapacity, std::true_type /* reallocatable */,
+                                      Arguments&&... arguments) {
+            // the element is constructed aside as the arguments get invalidated by the reallocation
+            typename std::aligned_storage<sizeof(ValueType), alignof(ValueType)>::type slot;
+            auto const value = reinterpret_cast<Pointer>(&slot);
+            Memory::construct(allocator(), value, std::forward<Arguments>(arguments)...);
+            try {
+                reallocateArray(newCapacity, std::true_type{});
+            } catch (...) {
+                Memory::destroy(allocator(), value);
+                throw;
+            }
+            recordGrowth(newCapacity, false);
+            capacity_ = newCapacity;
+
+            auto const target = array_ + index;
+            relocation::shiftRight(allocator(), target, array_ + size_, 1);
+            relocation::relocate(allocator(), value, 1, target);
+            ++size_;
 
-            auto const oldSize = size_++;
-            if (index == oldSize) Memory::construct(allocator_, array_ + size_, value);
-            else {
-                // the element should be constructed anyway, but using previous value
-                auto target = array_ + oldSize;
-                Memory::construct(allocator_, target, std::move(*(target - 1)));
-                // the elements after index should be moved to the right
-                // target is the element to move the value into
-                auto const bound = array_ + index;
-                for (; target != bound;) {
-                    auto const current = target--; // actual target to move the value into
-                    *current = std::move(*target);
-                }
-                // here target is the bound and contains the value to be destroyed
-                Memory::destroy(allocator_, target);
-                Memory::construct(allocator_, target, value);
+            return *target;
+        }
+
+        template<typename... Arguments>
+        reference emplaceReallocating(size_t const index, size_t const newCapacity, std::false_type /* reallocatable */,
+                                      Arguments&&... arguments) {
+            Pointer const newArray = Memory::allocate(allocator(), newCapacity);
+            // the element is constructed first as the arguments may refer to the elements which get relocated
+            try {
+                Memory::construct(allocator(), newArray + index, std::forward<Arguments>(arguments)...);
+            } catch (...) {
+                Memory::deallocate(allocator(), newArray, newCapacity);
+                throw;
+            }
+            try {
+                relocation::relocateAround(allocator(), array_, size_, index, newArray, 1);
+            } catch (...) {
+                Memory::destroy(allocator(), newArray + index);
+                Memory::deallocate(allocator(), newArray, newCapacity);
+                throw;
             }
+            recordGrowth(newCapacity, false);
+            releaseArray();
+
+            array_ = newArray;
+            capacity_ = newCapacity;
+            ++size_;
+
+            return newArray[index];
         }
 
-        void uncheckedInsert(ConstIterator const position, RValueReference value) {
-            // this should happen before reallocation as after the pointers change
-            auto const index = position - array_;
-            requireExtraSlot();
+        /**
+         * @brief Constructs a new element at the given index of the array which has an extra slot
+         * @param index index at which the element should be constructed
+         * @param arguments arguments used to construct the element, they should not refer to the shifted elements
+         * @return reference to the constructed element
+         */
+        template<typename... Arguments>
+        reference emplaceShifting(size_t const index, Arguments&&... arguments) {
+            return emplaceShifting(Shiftable{}, index, std::forward<Arguments>(arguments)...);
+        }
 
-            auto const oldSize = size_++;
-            if (index == oldSize) Memory::construct(allocator_, array_ + oldSize, std::forward<RValueReference>(value));
-            else {
-                // the element should be constructed anyway, but using previous value
-                auto target = array_ + oldSize;
-                Memory::construct(allocator_, target, std::move(*(target - 1)));
-                // the elements after index should be moved to the right
-                // target is the element to move the value into
-                auto const bound = array_ + index;
-                for (; target != bound;) {
-                    auto const current = target--; // actual target to move the value into
-                    *current = std::move(*target);
+        template<typename... Arguments>
+        reference emplaceShifting(std::true_type /* shiftable */, size_t const index, Arguments&&... arguments) {
+            auto const target = array_ + index, end = array_ + size_;
+            // free the slot by moving all elements after it to the right
+            relocation::shiftRight(allocator(), target, end, 1);
+            try {
+                Memory::construct(allocator(), target, std::forward<Arguments>(arguments)...);
+            } catch (...) {
+                relocation::shiftLeft(allocator(), target + 1, end + 1, 1);
+                throw;
+            }
+            ++size_;
+
+            return *target;
+        }
+
+        template<typename... Arguments>
+        reference emplaceShifting(std::false_type /* shiftable */, size_t const index, Arguments&&... arguments) {
+            auto const target = array_ + index, end = array_ + size_;
+            if (target == end) {
+                Memory::construct(allocator(), target, std::forward<Arguments>(arguments)...);
+                ++size_;
+
+                return *target;
+            }
+            // the move may throw so the elements get move-assigned to keep all slots constructed
+            Memory::construct(allocator(), end, std::move(end[-1]));
+            ++size_;
+            std::move_backward(target, end - 1, end);
+            *target = ValueType(std::forward<Arguments>(arguments)...);
+
+            return *target;
+        }
+
+        template<typename... Arguments>
+        reference uncheckedEmplace(size_t const index, Arguments&&... arguments) {
+            if (!hasExtraSlotInPlace()) {
+                return emplaceReallocating(index, grownCapacity(size_ + 1), Reallocatable{},
+                                           std::forward<Arguments>(arguments)...);
+            }
+            if (index == size_) return emplaceShifting(index, std::forward<Arguments>(arguments)...);
+
+            // the arguments may refer to the elements which get shifted so the value is created beforehand
+            ValueType value(std::forward<Arguments>(arguments)...);
+
+            return emplaceShifting(index, std::move(value));
+        }
+
+        void uncheckedInsert(size_t const index, ConstReference value) {
+            if (!hasExtraSlotInPlace()) {
+                emplaceReallocating(index, grownCapacity(size_ + 1), Reallocatable{}, value);
+            } else {
+                // if the value is one of the shifted elements then it is found in the next slot after the shift
+                auto source = std::addressof(value);
+                if (source >= array_ + index && source < array_ + size_) ++source;
+
+                emplaceShifting(index, *source);
+            }
+        }
+
+        void uncheckedInsert(size_t const index, RValueReference value) {
+            if (!hasExtraSlotInPlace()) {
+                emplaceReallocating(index, grownCapacity(size_ + 1), Reallocatable{},
+                                    std::forward<RValueReference>(value));
+            } else emplaceShifting(index, std::forward<RValueReference>(value));
+        }
+
+        /**
+         * @brief Inserts {@code count} elements before the given index
+         * @param index index at which the first element should be inserted
+         * @param count number of inserted elements
+         * @param construct function constructing all {@code count} elements in the given uninitialized memory
+         * (or none of them on exception)
+         */
+        template<typename Constructor>
+        void uncheckedInsertConstructed(size_t const index, size_t const count, Constructor construct) {
+            if (count == 0) return;
+
+            auto const requiredSize = size_ + count;
+            if (requiredSize > capacity_) {
+                auto const newCapacity = grownCapacity(requiredSize);
+                if (array_ == nullptr || !Extensions::tryExpand(allocator(), array_, capacity_, newCapacity)) {
+                    insertReallocating(index, count, newCapacity, construct, Reallocatable{});
+                    return;
                 }
-                // here target is the bound and contains the value to be destroyed,
-                // so we perform the last exchange - with the caller
-                *target = std::forward<RValueReference>(value);
+                recordGrowth(newCapacity, true);
+                capacity_ = newCapacity;
+            }
+
+            insertShifting(index, count, construct);
+        }
+
+        template<typename Constructor>
+        void insertShifting(size_t const index, size_t const count, Constructor& construct) {
+            insertShifting(index, count, construct, Shiftable{});
+        }
+
+        template<typename Constructor>
+        void insertShifting(size_t const index, size_t const count, Constructor& construct,
+                            std::true_type /* shiftable */) {
+            auto const target = array_ + index, end = array_ + size_;
+            // free the slots by moving all elements after them to the right at once
+            relocation::shiftRight(allocator(), target, end, count);
+            try {
+                construct(target);
+            } catch (...) {
+                relocation::shiftLeft(allocator(), target + count, end + count, count);
+                throw;
             }
+            size_ += count;
+        }
+
+        template<typename Constructor>
+        void insertShifting(size_t const index, size_t const count, Constructor& construct,
+                            std::false_type /* shiftable */) {
+            // the move may throw so the elements get appended and then rotated into their place by assignments
+            auto const end = array_ + size_;
+            construct(end);
+            size_ += count;
+            std::rotate(array_ + index, end, end + count);
         }
 
-        void uncheckedErase(ConstIterator const from, ConstIterator const to)
-                noexcept(std::is_nothrow_move_constructible<ValueType>::value) {
-            auto const end = cend();
-            // move all elements after (to) to the left
-            // target is the element on the left to which the element gets moved
-            // source is the element on the right from which the element gets moved
-            for (auto source = to, target = from; source != end; ++source) *target = std::move(*source);
-            auto const delta = to - from;
-            for (auto iterator = end - delta; iterator != end; ++iterator) Memory::destroy(allocator_, iterator);
+        template<typename Constructor>
+        void insertReallocating(size_t const index, size_t const count, size_t const newCapacity,
+                                Constructor& construct, std::true_type /* reallocatable */) {
+            reallocateArray(newCapacity, std::true_type{});
+            recordGrowth(newCapacity, false);
+            capacity_ = newCapacity;
+
+            insertShifting(index, count, construct);
+        }
+
+        template<typename Constructor>
+        void insertReallocating(size_t const index, size_t const count, size_t const newCapacity,
+                                Constructor& construct, std::false_type /* reallocatable */) {
+            Pointer const newArray = Memory::allocate(allocator(), newCapacity);
+            try {
+                construct(newArray + index);
+            } catch (...) {
+                Memory::deallocate(allocator(), newArray, newCapacity);
+                throw;
+            }
+            try {
+                relocation::relocateAround(allocator(), array_, size_, index, newArray, count);
+            } catch (...) {
+                destroyElements(newArray + index, count);
+                Memory::deallocate(allocator(), newArray, newCapacity);
+                throw;
+            }
+            recordGrowth(newCapacity, false);
+            releaseArray();
+
+            array_ = newArray;
+            capacity_ = newCapacity;
+            size_ += count;
+        }
+
+        template<typename ForwardIterator>
+        void uncheckedInsertRange(size_t const index, ForwardIterator const first, ForwardIterator const last,
+                                  std::forward_iterator_tag) {
+            auto const count = static_cast<size_t>(std::distance(first, last));
+            uncheckedInsertConstructed(index, count, [this, first, count](Pointer const target) {
+                constructCopies(target, first, count);
+            });
+        }
+
+        template<typename InputIterator>
+        void uncheckedInsertRange(size_t const index, InputIterator first, InputIterator const last,
+                                  std::input_iterator_tag) {
+            // the number of elements is unknown so they get appended and then rotated into their place
+            auto const oldSize = size_;
+            try {
+                for (; first != last; ++first) emplaceBack(*first);
+            } catch (...) {
+                for (size_t i = oldSize; i < size_; ++i) Memory::destroy(allocator(), array_ + i);
+                size_ = oldSize;
+                throw;
+            }
+            std::rotate(array_ + index, array_ + oldSize, array_ + size_);
+        }
+
+        void uncheckedErase(ConstPointer const from, ConstPointer const to)
+                noexcept(Shiftable::value || std::is_nothrow_move_assignable<ValueType>::value) {
+            if (from == to) return;
+
+            uncheckedErase(array_ + (from - array_), array_ + (to - array_), Shiftable{});
+        }
+
+        void uncheckedErase(Pointer const first, Pointer const last, std::true_type /* shiftable */) noexcept {
+            // destroy erased elements and move all elements after (to) to the left into their slots
+            for (auto iterator = first; iterator != last; ++iterator) Memory::destroy(allocator(), iterator);
+            auto const delta = last - first;
+            relocation::shiftLeft(allocator(), last, array_ + size_, delta);
 
             size_ -= delta;
         }
 
+        void uncheckedErase(Pointer const first, Pointer const last, std::false_type /* shiftable */)
+                noexcept(std::is_nothrow_move_assignable<ValueType>::value) {
+            // the move may throw so the elements get move-assigned to keep all slots constructed
+            auto const end = array_ + size_, newEnd = std::move(last, end, first);
+            destroyElements(newEnd, end - newEnd);
+
+            size_ -= end - newEnd;
+        }
+
+        /**
+         * @brief Removes the elements for which the predicate holds in a single pass
+         * moving each of the kept elements to the left at most once
+         * @param remove predicate called with the index and each of the elements in order exactly once
+         * @return number of removed elements
+         *
+         * @note if the predicate or a move assignment throws, the vector keeps all of its elements
+         * but some of them may be left in their moved-from states
+         */
+        template<typename Predicate>
+        size_t uncheckedCompact(Predicate& remove) {
+            auto const size = static_cast<size_t>(size_);
+            size_t read = 0;
+            while (read < size && !remove(read, static_cast<ConstReference>(array_[read]))) ++read;
+            if (read == size) return 0;
+
+            auto write = read++;
+            for (; read < size; ++read) {
+                if (!remove(read, static_cast<ConstReference>(array_[read]))) array_[write++] = std::move(array_[read]);
+            }
+            destroyElements(array_ + write, size - write);
+            size_ = write;
+
+            return size - write;
+        }
+
     public:
         /* *********************************************** Destructor *********************************************** */
 
         /**
          * @brief Destroys this vector freeing all allocated memory
          *
-         * @note while marking this as {@code virtual} may bring possible overhead, this allows safe extension
-         * of this class, while most (if not all) modern compilers are able to perform monomorphic inline caching
+         * @note this is not {@code virtual} so that the vector carries no vtable pointer,
+         * {@link PolymorphicVector} should be used if the vector has to be deleted through a pointer to its base
          */
-        virtual ~Vector() noexcept(std::is_nothrow_destructible<ValueType>::value) {
-            for (size_t i = 0; i < size_; ++i) Memory::destroy(allocator_, array_ + i);
-            Memory::deallocate(allocator_, array_, capacity_);
+        ~Vector() noexcept(std::is_nothrow_destructible<ValueType>::value) {
+            recordDestruction();
+            for (size_t i = 0; i < size_; ++i) Memory::destroy(allocator(), array_ + i);
+            releaseArray();
         }
 
         /* ********************************************** Constructors ********************************************** */
 
         /**
-         * @brief Creates a new empty vector of default capacity.
+         * @brief Creates a new empty vector.
+         *
+         * @note this does not allocate any memory, the array gets allocated once the first element is added
+         */
+        Vector() noexcept(std::is_nothrow_default_constructible<AllocatorType>::value) : Vector(AllocatorType()) {}
+
+        /**
+         * @brief Creates a new empty vector using the given allocator.
+         * @param allocator allocator used by this vector
+         *
+         * @note this does not allocate any memory, the array gets allocated once the first element is added
          */
-        Vector() : Vector(DEFAULT_CAPACITY, 0) {}
+        explicit Vector(AllocatorType const& allocator) noexcept
+            : AllocatorHolder(allocator), array_(nullptr), size_(0), capacity_(0) {}
+
+        /**
+         * @brief Creates a vector containing copies of the given values.
+         * @param values values which should be {@bold copied} into this vector
+         * @param allocator allocator used by this vector
+         */
+        Vector(std::initializer_list<ValueType> const values, AllocatorType const& allocator = AllocatorType())
+            : Vector(values.size(), 0, allocator) {
+            copyArrayNoChecks(values.begin(), values.size());
+        }
 
         /**
          * @brief Copy-constructs a vector from the specified one.
          * @param original vector whose contents should be {@bold copied} into this one
          */
-        Vector(Vector const& original) : Vector(original.size_) { copyArrayNoChecks(original.array_); }
+        Vector(Vector const& original)
+            : Vector(original, Memory::select_on_container_copy_construction(original.allocator())) {}
+
+        /**
+         * @brief Copy-constructs a vector from the specified one using the given allocator.
+         * @param original vector whose contents should be {@bold copied} into this one
+         * @param allocator allocator used by this vector
+         */
+        Vector(Vector const& original, AllocatorType const& allocator) : Vector(original.size_, 0, allocator) {
+            copyArrayNoChecks(original.array_, original.size_);
+        }
+
+        /**
+         * @brief Copy-constructs a vector from the specified one splitting the work across threads.
+         * @param original vector whose contents should be {@bold copied} into this one
+         *
+         * @note the allocator's {@code construct} and {@code destroy} should be safe to call concurrently
+         */
+        Vector(Vector const& original, ParallelTag)
+            : Vector(original.size_, 0, Memory::select_on_container_copy_construction(original.allocator())) {
+            copyArrayNoChecks(original.array_, original.size_, par);
+        }
 
         /**
          * @brief Move-constructs a vector from the specified one.
          * @param original vector whose contents should be {@bold moved} into this one
          */
         Vector(Vector&& original) noexcept
-            : array_(std::exchange(original.array_, nullptr)), size_(std::exchange(original.size_, 0)),
-              capacity_(std::exchange(original.capacity_, 0)) {}
+            : AllocatorHolder(std::move(original.allocator())), array_(std::exchange(original.array_, nullptr)),
+              size_(std::exchange(original.size_, 0)), capacity_(std::exchange(original.capacity_, 0)) {
+            original.invalidateIterators();
+        }
+
+        /**
+         * @brief Move-constructs a vector from the specified one using the given allocator.
+         * @param original vector whose contents should be {@bold moved} into this one
+         * @param allocator allocator used by this vector
+         *
+         * @note if the allocators are not equal then the elements get moved one by one
+         */
+        Vector(Vector&& original, AllocatorType const& allocator) : Vector(allocator) {
+            if (sharesAllocator(original)) stealArray(original);
+            else {
+                append(std::make_move_iterator(original.array_),
+                       std::make_move_iterator(original.array_ + original.size_));
+                original.clear();
+            }
+        }
 
         /* ****************************************** Assignment operators ****************************************** */
 
         Vector& operator=(Vector const& other) {
-            if (this != *other) {
-                if (size_ < other.size_) {
-                    array_ = Memory::allocate(allocator_, other.size_);
-                    size_ = other.size_;
-                    capacity_ = other.capacity_;
-                }
-                copyArrayNoChecks(other.array_, other.size_);
+            if (this != &other) {
+                copyAllocator(other, PropagateOnCopyAssignment{});
+                assignArray(other.array_, other.size_);
             }
 
             return *this;
         }
 
-        Vector& operator=(Vector&& other) noexcept {
-            std::swap(array_, other.array_);
-            std::swap(size_, other.size_);
-            std::swap(capacity_, other.capacity_);
+        Vector& operator=(Vector&& other) noexcept(PropagateOnMoveAssignment::value
+                                                   || std::allocator_traits<AllocatorType>::is_always_equal::value) {
+            if (this != &other) moveAssign(other, PropagateOnMoveAssignment{});
 
             return *this;
         }
 
-        void swap(Vector& other) noexcept {
-            std::swap(array_, other.array_);
-            std::swap(size_, other.size_);
-            std::swap(capacity_, other.capacity_);
+        void swap(Vector& other) noexcept(PropagateOnSwap::value
+                                          || std::allocator_traits<AllocatorType>::is_always_equal::value) {
+            if (PropagateOnSwap::value || sharesAllocator(other)) {
+                swapAllocators(other, PropagateOnSwap{});
+                invalidateIterators();
+                other.invalidateIterators();
+                std::swap(array_, other.array_);
+                std::swap(size_, other.size_);
+                std::swap(capacity_, other.capacity_);
+            } else {
+                // arrays cannot be exchanged so the elements get moved between the allocators
+                Vector temporary(std::move(other), allocator());
+                other = std::move(*this);
+                *this = std::move(temporary);
+            }
         }
 
+        AllocatorType getAllocator() const noexcept { return this->allocator(); }
+
         /* ********************************************* Indexed access ********************************************* */
 
-        reference operator[](size_t const index) { return array_[index]; }
+        reference operator[](size_t const index) {
+            checkAccess(index);
+
+            return array_[index];
+        }
 
-        ConstReference operator[](size_t const index) const { return array_[index]; }
+        ConstReference operator[](size_t const index) const {
+            checkAccess(index);
+
+            return array_[index];
+        }
 
         reference at(size_t const index) {
             checkRange(index);
@@ -273,21 +1113,25 @@ namespace collection {
 
         /* ***************************************** Iterators and pointers ***************************************** */
 
-        constexpr Iterator begin() { return array_; }
+        constexpr Iterator begin() { return iteratorTo(array_); }
 
-        constexpr ConstIterator cbegin() const { return array_; }
+        constexpr ConstIterator begin() const { return iteratorTo(array_); }
 
-        constexpr Iterator end() { return array_ + size_; }
+        constexpr ConstIterator cbegin() const { return iteratorTo(array_); }
 
-        constexpr ConstIterator cend() const { return array_ + size_; }
+        constexpr Iterator end() { return iteratorTo(array_ + size_); }
 
-        constexpr Iterator front() { return array_; }
+        constexpr ConstIterator end() const { return iteratorTo(array_ + size_); }
 
-        constexpr ConstIterator front() const { return array_; }
+        constexpr ConstIterator cend() const { return iteratorTo(array_ + size_); }
 
-        constexpr Iterator back() { return size_ == 0 ? end() : array_ + size_ - 1; }
+        constexpr Iterator front() { return iteratorTo(array_); }
 
-        constexpr ConstIterator back() const { return size_ == 0 ? cend() : array_ + size_ - 1; }
+        constexpr ConstIterator front() const { return iteratorTo(array_); }
+
+        constexpr Iterator back() { return iteratorTo(size_ == 0 ? array_ : array_ + size_ - 1); }
+
+        constexpr ConstIterator back() const { return iteratorTo(size_ == 0 ? array_ : array_ + size_ - 1); }
 
         constexpr Pointer data() { return array_; }
 
@@ -301,10 +1145,47 @@ namespace collection {
 
         size_t capacity() const noexcept { return capacity_; }
 
+        /**
+         * @brief Gets the maximal number of elements which the vector can hold.
+         * @return maximal number of elements limited by both the size type and the addressable memory
+         */
+        static constexpr size_t maxSize() noexcept {
+            return std::min(static_cast<size_t>(std::numeric_limits<SizeType>::max()),
+                            std::numeric_limits<size_t>::max() / sizeof(ValueType));
+        }
+
+        /* ************************************************* Search ************************************************* */
+
+        /**
+         * @brief Finds the first element equal to the value.
+         * @param value searched value
+         * @return iterator pointing to the found element or {@link #end()} if there is none
+         *
+         * @note integral elements are compared by vector instructions
+         */
+        Iterator find(ConstReference value) { return iteratorTo(array_ + simd::find<ValueType>(array_, size_, value)); }
+
+        ConstIterator find(ConstReference value) const {
+            return iteratorTo(array_ + simd::find<ValueType>(array_, size_, value));
+        }
+
+        /**
+         * @brief Counts the elements equal to the value.
+         * @param value counted value
+         * @return number of the elements equal to {@code value}
+         */
+        size_t count(ConstReference value) const { return simd::count<ValueType>(array_, size_, value); }
+
+        /**
+         * @brief Tells whether there is an element equal to the value.
+         * @param value searched value
+         */
+        bool contains(ConstReference value) const { return simd::find<ValueType>(array_, size_, value) != size_; }
+
         /* *********************************************** Modifiers *********************************************** */
 
         void reserve(size_t const newCapacity) {
-            if (capacity_ < newCapacity) resizeToBigger(newCapacity);
+            if (capacity_ < newCapacity) resizeToBigger(fittingCapacity(newCapacity));
         }
 
         void resize(size_t const newSize) {
@@ -312,82 +1193,395 @@ namespace collection {
 
             auto const currentSize = size_;
             if (newSize < currentSize) {
-                for (size_t i = newSize; i < currentSize; ++i) Memory::destroy(allocator_, array_ + i);
+                for (size_t i = newSize; i < currentSize; ++i) Memory::destroy(allocator(), array_ + i);
                 size_ = newSize; // simply decrease size
             } else if (newSize > currentSize) {
-                if (newSize > capacity_) resizeToBigger(newSize);
-                for (size_t i = currentSize; i < newSize; ++i) Memory::construct(allocator_, array_ + i, ValueType{});
+                if (newSize > capacity_) resizeToBigger(grownCapacity(newSize));
+                for (size_t i = currentSize; i < newSize; ++i) Memory::construct(allocator(), array_ + i);
                 // allocate new, bigger array
                 size_ = newSize;
             }
         }
 
+        /**
+         * @brief Resizes this vector leaving the new elements default-initialized
+         * i.e. their values are indeterminate until they get overwritten
+         * @param newSize new size of this vector
+         */
+        void resize(size_t const newSize, DefaultInitTag) {
+            static_assert(std::is_trivial<ValueType>::value, "Type should be trivial to be left uninitialized");
+
+            if (newSize > capacity_) resizeToBigger(grownCapacity(newSize));
+            size_ = newSize;
+        }
+
+        void resizeUninitialized(size_t const newSize) { resize(newSize, default_init); }
+
+        /**
+         * @brief Resizes this vector to at most {@code maxSize} elements letting the operation overwrite them,
+         * similarly to {@code std::basic_string::resize_and_overwrite}
+         * @param maxSize maximal size of this vector, new elements up to it are left uninitialized
+         * @param operation operation called with {@link #data()} and {@code maxSize}
+         * which should return the actual number of initialized elements not greater than {@code maxSize}
+         *
+         * @note this allows reading directly into the vector's memory, e.g. via {@code read()} or {@code recv()}
+         * @note if the operation throws or returns too many elements, the size is left unchanged
+         * while the elements may have been overwritten
+         */
+        template<typename Operation>
+        void resizeAndOverwrite(size_t const maxSize, Operation operation) {
+            static_assert(std::is_trivial<ValueType>::value, "Type should be trivial to be left uninitialized");
+
+            if (maxSize > capacity_) resizeToBigger(grownCapacity(maxSize));
+            // the size is only updated once the operation succeeds so that no uninitialized element gets exposed
+            auto const newSize = static_cast<size_t>(std::move(operation)(array_, maxSize));
+            if (newSize > maxSize) detail::throwLengthError("`operation` result should not be greater than `maxSize`");
+            size_ = newSize;
+        }
+
         void resize(size_t const newSize, ConstReference value) {
             auto const currentSize = size_;
             if (newSize < currentSize) {
-                for (size_t i = newSize; i < currentSize; ++i) Memory::destroy(allocator_, array_ + i);
+                for (size_t i = newSize; i < currentSize; ++i) Memory::destroy(allocator(), array_ + i);
                 size_ = newSize; // simply decrease size
+            } else if (newSize > currentSize) insert(cend(), newSize - currentSize, value); // value may be an element
+        }
+
+        /**
+         * @brief Resizes this vector splitting the destruction or construction of the elements across threads.
+         * @param newSize new size of this vector
+         * @param value value whose copies get appended, it may be an element of this vector
+         *
+         * @note if any of the copies cannot be created, all of the appended ones get destroyed
+         */
+        void resize(size_t const newSize, ConstReference value, ParallelTag) {
+            auto const currentSize = size_;
+            if (newSize < currentSize) {
+                destroyElements(array_ + newSize, currentSize - newSize, par);
+                size_ = newSize;
             } else if (newSize > currentSize) {
-                if (newSize > capacity_) resizeToBigger(newSize);
-                for (size_t i = currentSize; i < newSize; ++i) Memory::construct(allocator_, array_ + i, value);
-                // allocate new, bigger array
+                if (std::addressof(value) >= array_ && std::addressof(value) < array_ + size_) {
+                    // the value may get relocated by the growth so a copy of it is used
+                    ValueType const copy(value);
+                    resize(newSize, copy, par);
+                    return;
+                }
+
+                if (newSize > capacity_) resizeToBigger(grownCapacity(newSize));
+                auto const target = array_ + currentSize;
+                parallel::forEachChunk(
+                        newSize - currentSize,
+                        [this, target, &value](size_t const first, size_t const count) {
+                            constructFill(target + first, count, value);
+                        },
+                        [this, target](size_t const first, size_t const count) noexcept {
+                            destroyElements(target + first, count);
+                        });
                 size_ = newSize;
             }
         }
 
+        /**
+         * @brief Assigns the value to all elements.
+         * @param value assigned value, it may be an element of this vector
+         */
+        void fill(ConstReference value) { fill(value, BitwiseFillable{}); }
+
         // differs from standard implementation as it
         void clear() {
-            for (size_t i = 0; i < size_; ++i) Memory::destroy(allocator_, array_ + i);
+            for (size_t i = 0; i < size_; ++i) Memory::destroy(allocator(), array_ + i);
             size_ = 0;
         }
 
-        void insert(Iterator position, ConstReference value) {
-            if (position < array_) throw std::range_error("`position` is out of lower range");
-            if (position > array_ + 1) throw std::range_error("`position` is out of higher range");
+        /**
+         * @brief Destroys all elements splitting the work across threads.
+         *
+         * @note this may be called before the destruction of a huge vector so that its teardown takes less time
+         */
+        void clear(ParallelTag) noexcept {
+            destroyElements(array_, size_, par);
+            size_ = 0;
+        }
 
-            uncheckedInsert(position, value);
+        void insert(ConstIterator const position, ConstReference value) {
+            uncheckedInsert(checkedIndex(position), value);
         }
 
         void insert(ConstIterator const position, RValueReference value) {
-            if (position < array_) throw std::range_error("`position` is out of lower bound");
-            if (position > cend()) throw std::range_error("`position` is out of higher bound");
+            uncheckedInsert(checkedIndex(position), std::forward<RValueReference>(value));
+        }
 
-            uncheckedInsert(position, std::forward<RValueReference>(value));
+        /**
+         * @brief Inserts copies of the elements of the range before the given position
+         * @param position position before which the elements should be inserted
+         * @param first iterator pointing to the first inserted element, it should not point into this vector
+         * @param last iterator pointing after the last inserted element
+         *
+         * @note forward ranges are inserted by a single shift of the following elements
+         */
+        template<typename InputIterator,
+                 typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+        void insert(ConstIterator const position, InputIterator const first, InputIterator const last) {
+            uncheckedInsertRange(checkedIndex(position), first, last,
+                                 typename std::iterator_traits<InputIterator>::iterator_category{});
         }
 
-        void erase(ConstIterator const from, ConstIterator const to) {
-            if (from > to) throw std::logic_error("`from` cannot be after `to`");
-            if (from < array_) throw std::range_error("`from` is out of lower bound");
-            if (to < array_) throw std::range_error("`to` is out of lower bound");
-            auto const end = cend();
-            if (from > end) throw std::range_error("`from` is out of higher bound");
-            if (to > end) throw std::range_error("`to` is out of higher bound");
+        void insert(ConstIterator const position, std::initializer_list<ValueType> const values) {
+            insert(position, values.begin(), values.end());
+        }
+
+        /**
+         * @brief Inserts copies of the value before the given position
+         * @param position position before which the elements should be inserted
+         * @param count number of inserted copies
+         * @param value value to be copied, it may be an element of this vector
+         */
+        void insert(ConstIterator const position, size_t const count, ConstReference value) {
+            auto const index = checkedIndex(position);
+            if (std::addressof(value) >= array_ && std::addressof(value) < array_ + size_) {
+                // the value gets moved by the insertion so a copy of it is used
+                ValueType const copy(value);
+                insert(position, count, copy);
+            } else {
+                uncheckedInsertConstructed(index, count, [this, count, &value](Pointer const target) {
+                    constructFill(target, count, value);
+                });
+            }
+        }
+
+        template<typename InputIterator,
+                 typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+        void append(InputIterator const first, InputIterator const last) {
+            uncheckedInsertRange(size_, first, last, typename std::iterator_traits<InputIterator>::iterator_category{});
+        }
+
+        /**
+         * @brief Appends copies of the elements of the range
+         * @param range range providing {@code begin()} and {@code end()}, it should not be this vector
+         */
+        template<typename Range>
+        void append(Range const& range) {
+            using std::begin;
+            using std::end;
+            append(begin(range), end(range));
+        }
 
-            uncheckedErase(from, to);
+        /**
+         * @brief Constructs a new element in place before the given position
+         * @param position position before which the element should be constructed
+         * @param arguments arguments forwarded to the element's constructor, they may refer to this vector's elements
+         * @return reference to the constructed element
+         */
+        template<typename... Arguments>
+        reference emplace(ConstIterator const position, Arguments&&... arguments) {
+            return uncheckedEmplace(checkedIndex(position), std::forward<Arguments>(arguments)...);
+        }
+
+        void erase(ConstIterator const from, ConstIterator const to) {
+            auto const first = pointerOf(from), last = pointerOf(to);
+#if COLLECTION_VECTOR_CHECKS >= 1
+            if (first > last) detail::throwLogicError("`from` cannot be after `to`");
+            if (first < array_) detail::throwRangeError("`from` is out of lower bound");
+            if (last < array_) detail::throwRangeError("`to` is out of lower bound");
+            auto const end = array_ + size_;
+            if (first > end) detail::throwRangeError("`from` is out of higher bound");
+            if (last > end) detail::throwRangeError("`to` is out of higher bound");
+#endif
+
+            uncheckedErase(first, last);
+            shrinkAfterRemoval();
         }
 
         void erase(Iterator const position) { erase(position, position + 1); }
 
-        void pushBack(ConstReference value) {
-            requireExtraSlot();
+        /**
+         * @brief Erases the element in constant time by moving the last element into its place
+         * so that the order of the elements is not preserved
+         * @param position position of the erased element
+         * @return iterator pointing to the element which has taken the place of the erased one
+         * (which is {@link #end()} if the erased element was the last one)
+         */
+        Iterator swapErase(ConstIterator const position) {
+            auto const pointer = pointerOf(position);
+#if COLLECTION_VECTOR_CHECKS >= 1
+            if (pointer < array_) detail::throwRangeError("`position` is out of lower bound");
+            if (pointer >= array_ + size_) detail::throwRangeError("`position` is out of higher bound");
+#endif
+
+            auto const index = static_cast<size_t>(pointer - array_);
+            auto const last = array_ + size_ - 1;
+            if (array_ + index != last) array_[index] = std::move(*last);
+            Memory::destroy(allocator(), last);
+            --size_;
+            shrinkAfterRemoval();
+
+            return iteratorTo(array_ + index);
+        }
+
+        /**
+         * @brief Erases all elements satisfying the predicate in a single pass preserving the order of the rest
+         * @param predicate predicate called once for each element
+         * @return number of erased elements
+         */
+        template<typename Predicate>
+        size_t eraseIf(Predicate predicate) {
+            auto remove = [&predicate](size_t, ConstReference value) -> bool { return predicate(value); };
+            auto const erased = uncheckedCompact(remove);
+            shrinkAfterRemoval();
 
-            auto* const address = array_ + size_++;
-            Memory::construct(allocator_, address, value);
+            return erased;
         }
 
-        void pushBack(RValueReference value) {
-            requireExtraSlot();
+        /**
+         * @brief Erases all elements satisfying the predicate, this is the same as {@link #eraseIf()}
+         * @param predicate predicate called once for each element
+         * @return number of erased elements
+         */
+        template<typename Predicate>
+        size_t removeIf(Predicate predicate) {
+            return eraseIf(std::move(predicate));
+        }
+
+        /**
+         * @brief Erases the elements at the given indices in a single pass preserving the order of the rest
+         * @param first iterator pointing to the first index, the indices should be strictly ascending
+         * @param last iterator pointing after the last index
+         * @return number of erased elements
+         */
+        template<typename ForwardIterator,
+                 typename = typename std::enable_if<!std::is_integral<ForwardIterator>::value>::type>
+        size_t eraseIndices(ForwardIterator const first, ForwardIterator const last) {
+            if (first == last) return 0;
+            // validate the indices before any element gets moved
+            for (auto current = first, next = std::next(first); next != last; current = next++) {
+                if (!(static_cast<size_t>(*current) < static_cast<size_t>(*next))) {
+                    detail::throwLogicError("`indices` should be strictly ascending");
+                }
+                if (static_cast<size_t>(*next) >= size_) detail::throwOutOfRange(static_cast<size_t>(*next), size_);
+            }
+            checkRange(static_cast<size_t>(*first));
+
+            auto cursor = first;
+            auto remove = [&cursor, last](size_t const index, ConstReference) -> bool {
+                if (cursor == last || static_cast<size_t>(*cursor) != index) return false;
+                ++cursor;
 
-            auto* const address = array_ + size_++;
-            Memory::construct(allocator_, address, std::forward<RValueReference>(value));
+                return true;
+            };
+            auto const erased = uncheckedCompact(remove);
+            shrinkAfterRemoval();
+
+            return erased;
+        }
+
+        /**
+         * @brief Erases the elements at the given indices in a single pass preserving the order of the rest
+         * @param indices range of strictly ascending indices providing {@code begin()} and {@code end()}
+         * @return number of erased elements
+         */
+        template<typename Range>
+        size_t eraseIndices(Range const& indices) {
+            using std::begin;
+            using std::end;
+
+            return eraseIndices(begin(indices), end(indices));
+        }
+
+        size_t eraseIndices(std::initializer_list<size_t> const indices) {
+            return eraseIndices(indices.begin(), indices.end());
+        }
+
+        /**
+         * @brief Constructs a new element in place after the last one
+         * @param arguments arguments forwarded to the element's constructor, they may refer to this vector's elements
+         * @return reference to the constructed element
+         */
+        template<typename... Arguments>
+        reference emplaceBack(Arguments&&... arguments) {
+            if (!hasExtraSlotInPlace()) {
+                return emplaceReallocating(size_, grownCapacity(size_ + 1), Reallocatable{},
+                                           std::forward<Arguments>(arguments)...);
+            }
+
+            auto* const address = array_ + size_;
+            Memory::construct(allocator(), address, std::forward<Arguments>(arguments)...);
+            ++size_;
+
+            return *address;
         }
 
+        void pushBack(ConstReference value) { emplaceBack(value); }
+
+        void pushBack(RValueReference value) { emplaceBack(std::forward<RValueReference>(value)); }
+
         void popBack() {
+#if COLLECTION_VECTOR_CHECKS >= 1
             checkNotEmpty();
+#endif
 
-            Memory::destroy(allocator_, array_ + (--size_));
+            Memory::destroy(allocator(), array_ + (--size_));
+            shrinkAfterRemoval();
+        }
+
+        /**
+         * @brief Releases the unused capacity.
+         */
+        void shrinkToFit() { shrinkTo(size_); }
+
+        /**
+         * @brief Shrinks the capacity to the given one (or the size if it is bigger) releasing the unused memory.
+         * @param capacityHint capacity which should be left
+         *
+         * @note the growth policy may round the capacity up
+         */
+        void shrinkTo(size_t const capacityHint) {
+            auto const newCapacity = fittingCapacity(std::max(static_cast<size_t>(size_), capacityHint));
+            if (newCapacity < capacity_) resizeToSmaller(newCapacity);
         }
     };
+
+    /* ************************************************* Comparison ************************************************* */
+
+    template<typename Value, typename Allocator, typename GrowthPolicy, typename SizeType>
+    bool operator==(Vector<Value, Allocator, GrowthPolicy, SizeType> const& left,
+                    Vector<Value, Allocator, GrowthPolicy, SizeType> const& right) {
+        return left.size() == right.size() && simd::mismatch(left.data(), right.data(), left.size()) == left.size();
+    }
+
+    template<typename Value, typename Allocator, typename GrowthPolicy, typename SizeType>
+    bool operator!=(Vector<Value, Allocator, GrowthPolicy, SizeType> const& left,
+                    Vector<Value, Allocator, GrowthPolicy, SizeType> const& right) {
+        return !(left == right);
+    }
+
+    template<typename Value, typename Allocator, typename GrowthPolicy, typename SizeType>
+    bool operator<(Vector<Value, Allocator, GrowthPolicy, SizeType> const& left,
+                   Vector<Value, Allocator, GrowthPolicy, SizeType> const& right) {
+        return simd::compare(left.data(), left.size(), right.data(), right.size()) < 0;
+    }
+
+    template<typename Value, typename Allocator, typename GrowthPolicy, typename SizeType>
+    bool operator<=(Vector<Value, Allocator, GrowthPolicy, SizeType> const& left,
+                    Vector<Value, Allocator, GrowthPolicy, SizeType> const& right) {
+        return simd::compare(left.data(), left.size(), right.data(), right.size()) <= 0;
+    }
+
+    template<typename Value, typename Allocator, typename GrowthPolicy, typename SizeType>
+    bool operator>(Vector<Value, Allocator, GrowthPolicy, SizeType> const& left,
+                   Vector<Value, Allocator, GrowthPolicy, SizeType> const& right) {
+        return simd::compare(left.data(), left.size(), right.data(), right.size()) > 0;
+    }
+
+    template<typename Value, typename Allocator, typename GrowthPolicy, typename SizeType>
+    bool operator>=(Vector<Value, Allocator, GrowthPolicy, SizeType> const& left,
+                    Vector<Value, Allocator, GrowthPolicy, SizeType> const& right) {
+        return simd::compare(left.data(), left.size(), right.data(), right.size()) >= 0;
+    }
+
+    // the checked iterators additionally need the generation of the array
+    static_assert(sizeof(Vector<int>) == (COLLECTION_VECTOR_CHECKS >= 2 ? 4 : 3) * sizeof(void*),
+                  "Vector should consist of its fields only");
+    static_assert(std::is_standard_layout<Vector<int>>::value, "Vector should have standard layout");
 } // namespace collection
 
 
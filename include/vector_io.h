@@ -0,0 +1,504 @@
+#ifndef INCLUDE_VECTOR_IO_H_
+#define INCLUDE_VECTOR_IO_H_
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <vector.h>
+
+namespace collection {
+
+    /*
+     * Vectors are serialized as a sequence of chunks each of which is a 64-bit number of elements
+     * followed by the serialized elements, the sequence is terminated by an empty chunk.
+     * Numbers and trivially copyable elements are written in the native byte order
+     * so the data should only be read on the machines of the same architecture.
+     *
+     * A sink is a type providing the following members:
+     *
+     * void write(void const* data, size_t size)
+     *     writes all bytes of the buffer
+     *
+     * void writeGather(iovec const* buffers, size_t count)
+     *     writes all bytes of the buffers in order
+     *
+     * A source is a type providing the following member:
+     *
+     * void read(void* data, size_t size)
+     *     reads exactly the given number of bytes throwing if the input ends earlier
+     */
+
+    /**
+     * @brief Serializer writing the bytes of the value as is
+     * @tparam Value type of serialized value which should be trivially copyable
+     */
+    template<typename Value>
+    struct BitwiseSerializer {
+        static_assert(std::is_trivially_copyable<Value>::value, "Type should be trivially copyable");
+
+        template<typename Sink>
+        static void write(Sink& sink, Value const& value) {
+            sink.write(&value, sizeof(Value));
+        }
+
+        template<typename Source>
+        static Value read(Source& source) {
+            typename std::aligned_storage<sizeof(Value), alignof(Value)>::type storage;
+            source.read(&storage, sizeof(Value));
+
+            return *reinterpret_cast<Value const*>(&storage);
+        }
+    };
+
+    /**
+     * @brief Hook for serialization of the values, it should be specialized for the types
+     * which are not trivially copyable (e.g. the ones holding strings) providing
+     * {@code template<typename Sink> static void write(Sink&, Value const&)} and
+     * {@code template<typename Source> static Value read(Source&)}
+     *
+     * @tparam Value type of serialized value
+     *
+     * @note trivially copyable types are serialized bitwise (and thus in bulk) unless the hook is specialized for them
+     */
+    template<typename Value, typename = void>
+    struct Serializer {
+        // the condition depends on the type so that it only fails once the missing specialization gets used
+        static_assert(!std::is_same<Value, Value>::value,
+                      "collection::Serializer should be specialized for the type which is not trivially copyable");
+    };
+
+    template<typename Value>
+    struct Serializer<Value, typename std::enable_if<std::is_trivially_copyable<Value>::value>::type>
+        : BitwiseSerializer<Value> {};
+
+    /**
+     * @brief Serializer of strings writing their length followed by their characters
+     */
+    template<>
+    struct Serializer<std::string> {
+        template<typename Sink>
+        static void write(Sink& sink, std::string const& value) {
+            BitwiseSerializer<std::uint64_t>::write(sink, value.size());
+            sink.write(value.data(), value.size());
+        }
+
+        template<typename Source>
+        static std::string read(Source& source) {
+            auto const length = BitwiseSerializer<std::uint64_t>::read(source);
+            std::string value;
+            // the length is untrusted so the string grows along with the actually read characters
+            constexpr std::uint64_t SLICE_SIZE = 1u << 16u;
+            for (auto remaining = length; remaining != 0;) {
+                auto const slice = static_cast<size_t>(std::min(remaining, SLICE_SIZE));
+                auto const offset = value.size();
+                value.resize(offset + slice);
+                source.read(&value[offset], slice);
+                remaining -= slice;
+            }
+
+            return value;
+        }
+    };
+
+    /**
+     * @brief Tells whether the elements of the type get serialized by copying their bytes as is
+     * so that the arrays of them may be written and read in bulk
+     * @tparam Value type of serialized value
+     */
+    template<typename Value>
+    struct serializes_bitwise : std::is_base_of<BitwiseSerializer<Value>, Serializer<Value>> {};
+
+    namespace io {
+
+        /**
+         * @brief Maximal number of buffers passed to a single {@code writev} call
+         */
+        constexpr size_t MAX_GATHER_COUNT = 1024;
+
+        /**
+         * @brief Maximal number of bytes of elements read in bulk before the vector grows again
+         * so that corrupted input cannot make it allocate much more than the input holds
+         */
+        constexpr size_t MAX_READ_SLICE_SIZE = size_t{1} << 20u;
+
+        /**
+         * @brief Number of buffers of {@link GatherView}: the chunk's header, the elements and the terminating chunk
+         */
+        constexpr size_t GATHER_VIEW_BUFFER_COUNT = 3;
+
+        [[noreturn]] inline void throwSystemError(char const* const operation) {
+            throw std::system_error(errno, std::generic_category(), operation);
+        }
+
+        [[noreturn]] inline void throwEndOfInput() { throw std::runtime_error("Unexpected end of input"); }
+
+        /* *********************************************** File sinks *********************************************** */
+
+        /**
+         * @brief Sink writing to the file descriptor, retrying interrupted and partial writes
+         */
+        class FileDescriptorSink {
+            int file_;
+
+        public:
+            explicit FileDescriptorSink(int const file) noexcept : file_(file) {}
+
+            void write(void const* data, size_t size) {
+                while (size != 0) {
+                    auto const written = ::write(file_, data, size);
+                    if (written < 0) {
+                        if (errno == EINTR) continue;
+                        throwSystemError("write");
+                    }
+                    data = static_cast<char const*>(data) + written;
+                    size -= static_cast<size_t>(written);
+                }
+            }
+
+            void writeGather(iovec const* buffers, size_t count) {
+                while (count != 0) {
+                    auto const written = ::writev(file_, buffers, static_cast<int>(std::min(count, MAX_GATHER_COUNT)));
+                    if (written < 0) {
+                        if (errno == EINTR) continue;
+                        throwSystemError("writev");
+                    }
+
+                    auto remaining = static_cast<size_t>(written);
+                    for (; count != 0 && remaining >= buffers->iov_len; ++buffers, --count) {
+                        remaining -= buffers->iov_len;
+                    }
+                    if (remaining != 0) {
+                        // the buffer has been written partially
+                        write(static_cast<char const*>(buffers->iov_base) + remaining, buffers->iov_len - remaining);
+                        ++buffers;
+                        --count;
+                    }
+                }
+            }
+        };
+
+        /**
+         * @brief Source reading from the file descriptor, retrying interrupted and partial reads
+         */
+        class FileDescriptorSource {
+            int file_;
+
+        public:
+            explicit FileDescriptorSource(int const file) noexcept : file_(file) {}
+
+            void read(void* data, size_t size) {
+                while (size != 0) {
+                    auto const read = ::read(file_, data, size);
+                    if (read < 0) {
+                        if (errno == EINTR) continue;
+                        throwSystemError("read");
+                    }
+                    if (read == 0) throwEndOfInput();
+                    data = static_cast<char*>(data) + read;
+                    size -= static_cast<size_t>(read);
+                }
+            }
+        };
+
+        /* ********************************************** Stream sinks ********************************************** */
+
+        /**
+         * @brief Sink writing to the output stream
+         */
+        class StreamSink {
+            std::ostream* stream_;
+
+        public:
+            explicit StreamSink(std::ostream& stream) noexcept : stream_(&stream) {}
+
+            void write(void const* const data, size_t const size) {
+                if (!stream_->write(static_cast<char const*>(data), static_cast<std::streamsize>(size))) {
+                    throw std::runtime_error("Failed to write to the stream");
+                }
+            }
+
+            void writeGather(iovec const* const buffers, size_t const count) {
+                for (size_t i = 0; i < count; ++i) write(buffers[i].iov_base, buffers[i].iov_len);
+            }
+        };
+
+        /**
+         * @brief Source reading from the input stream
+         */
+        class StreamSource {
+            std::istream* stream_;
+
+        public:
+            explicit StreamSource(std::istream& stream) noexcept : stream_(&stream) {}
+
+            void read(void* const data, size_t const size) {
+                if (!stream_->read(static_cast<char*>(data), static_cast<std::streamsize>(size))) throwEndOfInput();
+            }
+        };
+
+        /* ********************************************** Gather view *********************************************** */
+
+        /**
+         * @brief Scatter-gather view of the serialized vector of bitwise serialized elements
+         * which refers to the vector's memory so that it may be sent without copying (e.g. via {@code writev})
+         *
+         * @note the vector should not be modified while the view is used
+         */
+        class GatherView {
+            std::uint64_t counts_[2];
+            void const* data_;
+            size_t bytes_;
+
+        public:
+            /**
+             * @brief Creates a view of the vector serialized as a single chunk.
+             * @param vector viewed vector
+             */
+            template<typename Value, typename Allocator, typename GrowthPolicy, typename SizeType>
+            explicit GatherView(Vector<Value, Allocator, GrowthPolicy, SizeType> const& vector) noexcept
+                : counts_{vector.size(), 0}, data_(vector.data()), bytes_(vector.size() * sizeof(Value)) {
+                static_assert(serializes_bitwise<Value>::value, "Elements should be serialized bitwise");
+            }
+
+            /**
+             * @brief Gets the buffers of the view pointing to this view (for the chunks' headers)
+             * and to the vector (for the elements) so that this view should outlive them.
+             * @return buffers only the first {@link #bufferCount()} of which are used
+             */
+            std::array<iovec, GATHER_VIEW_BUFFER_COUNT> buffers() const noexcept {
+                return {{{const_cast<std::uint64_t*>(&counts_[0]), sizeof(std::uint64_t)},
+                         {const_cast<void*>(data_), bytes_},
+                         {const_cast<std::uint64_t*>(&counts_[1]), sizeof(std::uint64_t)}}};
+            }
+
+            /**
+             * @brief Gets the number of used buffers, the empty vector is just the terminating chunk.
+             */
+            size_t bufferCount() const noexcept { return counts_[0] == 0 ? 1 : GATHER_VIEW_BUFFER_COUNT; }
+
+            /**
+             * @brief Gets the total number of bytes in the buffers.
+             */
+            size_t byteCount() const noexcept {
+                return counts_[0] == 0 ? sizeof(std::uint64_t) : 2 * sizeof(std::uint64_t) + bytes_;
+            }
+        };
+
+        /* **************************************** Chunk writer and reader ***************************************** */
+
+        /**
+         * @brief Writer of the chunks of elements allowing to stream a vector whose size is not known up front
+         * @tparam Sink type of sink to which the chunks are written
+         */
+        template<typename Sink>
+        class ChunkWriter {
+            Sink sink_;
+
+            template<typename Value>
+            void writeElements(Value const* const values, size_t const count, std::true_type /* bitwise */) {
+                std::uint64_t const header = count;
+                iovec const buffers[] = {{const_cast<std::uint64_t*>(&header), sizeof(header)},
+                                         {const_cast<Value*>(values), count * sizeof(Value)}};
+                sink_.writeGather(buffers, 2);
+            }
+
+            template<typename Value>
+            void writeElements(Value const* const values, size_t const count, std::false_type /* bitwise */) {
+                BitwiseSerializer<std::uint64_t>::write(sink_, count);
+                for (size_t i = 0; i < count; ++i) Serializer<Value>::write(sink_, values[i]);
+            }
+
+        public:
+            explicit ChunkWriter(Sink sink) : sink_(std::forward<Sink>(sink)) {}
+
+            /**
+             * @brief Writes the elements as a single chunk, bitwise serialized elements get written in bulk.
+             * @param values pointer to the first written element
+             * @param count number of written elements
+             */
+            template<typename Value>
+            void writeChunk(Value const* const values, size_t const count) {
+                // an empty chunk would terminate the sequence
+                if (count != 0) writeElements(values, count, serializes_bitwise<Value>{});
+            }
+
+            template<typename Value, typename Allocator, typename GrowthPolicy, typename SizeType>
+            void writeChunk(Vector<Value, Allocator, GrowthPolicy, SizeType> const& vector) {
+                writeChunk(vector.data(), vector.size());
+            }
+
+            /**
+             * @brief Terminates the sequence of chunks.
+             */
+            void finish() { BitwiseSerializer<std::uint64_t>::write(sink_, std::uint64_t{0}); }
+        };
+
+        /**
+         * @brief Reader of the chunks of elements appending them to vectors
+         * @tparam Source type of source from which the chunks are read
+         */
+        template<typename Source>
+        class ChunkReader {
+            Source source_;
+            bool finished_;
+
+            template<typename Target>
+            void readElements(Target& vector, size_t count, std::true_type /* in bulk */) {
+                typedef typename Target::ValueType Value;
+
+                // the vector grows by the growth policy at most by a slice at a time
+                auto const sliceCount = std::max(MAX_READ_SLICE_SIZE / sizeof(Value), size_t{1});
+                while (count != 0) {
+                    auto const slice = std::min(count, sliceCount);
+                    auto const offset = vector.size();
+                    vector.resizeAndOverwrite(offset + slice, [this, offset, slice](Value* const data, size_t) {
+                        source_.read(data + offset, slice * sizeof(Value));
+
+                        return offset + slice;
+                    });
+                    count -= slice;
+                }
+            }
+
+            template<typename Target>
+            void readElements(Target& vector, size_t const count, std::false_type /* in bulk */) {
+                typedef typename Target::ValueType Value;
+
+                for (size_t i = 0; i < count; ++i) vector.emplaceBack(Serializer<Value>::read(source_));
+            }
+
+        public:
+            explicit ChunkReader(Source source) : source_(std::forward<Source>(source)), finished_(false) {}
+
+            /**
+             * @brief Tells whether the terminating chunk has been read.
+             */
+            bool finished() const noexcept { return finished_; }
+
+            /**
+             * @brief Appends the elements of the next chunk to the vector.
+             * @param vector vector to which the elements are appended
+             * @return {@code false} if the sequence has been terminated and {@code true} otherwise
+             *
+             * @note if the input cannot be read, the vector is left unchanged
+             */
+            template<typename Value, typename Allocator, typename GrowthPolicy, typename SizeType>
+            bool readChunk(Vector<Value, Allocator, GrowthPolicy, SizeType>& vector) {
+                if (finished_) return false;
+
+                auto const count = BitwiseSerializer<std::uint64_t>::read(source_);
+                if (count == 0) {
+                    finished_ = true;
+                    return false;
+                }
+
+                auto const oldSize = vector.size();
+                try {
+                    readElements(vector, static_cast<size_t>(count),
+                                 std::integral_constant<bool, serializes_bitwise<Value>::value
+                                                                      && std::is_trivial<Value>::value>{});
+                } catch (...) {
+                    vector.erase(vector.cbegin() + oldSize, vector.cend());
+                    throw;
+                }
+
+                return true;
+            }
+
+            /**
+             * @brief Appends the elements of all remaining chunks to the vector.
+             * @param vector vector to which the elements are appended
+             */
+            template<typename Value, typename Allocator, typename GrowthPolicy, typename SizeType>
+            void readAll(Vector<Value, Allocator, GrowthPolicy, SizeType>& vector) {
+                while (readChunk(vector)) {}
+            }
+        };
+
+        /* ************************************************ Bridges ************************************************* */
+
+        template<typename Sink, typename Value, typename Allocator, typename GrowthPolicy, typename SizeType>
+        void write(Sink& sink, Vector<Value, Allocator, GrowthPolicy, SizeType> const& vector, std::true_type) {
+            GatherView const view(vector);
+            sink.writeGather(view.buffers().data(), view.bufferCount());
+        }
+
+        template<typename Sink, typename Value, typename Allocator, typename GrowthPolicy, typename SizeType>
+        void write(Sink& sink, Vector<Value, Allocator, GrowthPolicy, SizeType> const& vector, std::false_type) {
+            ChunkWriter<Sink&> writer(sink);
+            writer.writeChunk(vector);
+            writer.finish();
+        }
+    } // namespace io
+
+    /* *********************************************** Serialization ************************************************ */
+
+    /**
+     * @brief Writes the vector to the file descriptor, bitwise serialized elements get written by a single
+     * {@code writev} call (unless the write is partial).
+     * @param file file descriptor to which the vector is written
+     * @param vector written vector
+     *
+     * @throws std::system_error if the write fails
+     */
+    template<typename Value, typename Allocator, typename GrowthPolicy, typename SizeType>
+    void writeTo(int const file, Vector<Value, Allocator, GrowthPolicy, SizeType> const& vector) {
+        io::FileDescriptorSink sink(file);
+        io::write(sink, vector, serializes_bitwise<Value>{});
+    }
+
+    /**
+     * @brief Writes the vector to the output stream.
+     * @param stream stream to which the vector is written
+     * @param vector written vector
+     *
+     * @throws std::runtime_error if the write fails
+     */
+    template<typename Value, typename Allocator, typename GrowthPolicy, typename SizeType>
+    void writeTo(std::ostream& stream, Vector<Value, Allocator, GrowthPolicy, SizeType> const& vector) {
+        io::StreamSink sink(stream);
+        io::write(sink, vector, serializes_bitwise<Value>{});
+    }
+
+    /**
+     * @brief Reads the vector from the file descriptor appending its elements to the given one.
+     * @param file file descriptor from which the vector is read
+     * @param vector vector to which the elements are appended
+     *
+     * @throws std::system_error if the read fails
+     * @throws std::runtime_error if the input ends before the vector does
+     * @note if the vector cannot be read, only the completely read chunks are left appended
+     */
+    template<typename Value, typename Allocator, typename GrowthPolicy, typename SizeType>
+    void readFrom(int const file, Vector<Value, Allocator, GrowthPolicy, SizeType>& vector) {
+        io::ChunkReader<io::FileDescriptorSource>(io::FileDescriptorSource(file)).readAll(vector);
+    }
+
+    /**
+     * @brief Reads the vector from the input stream appending its elements to the given one.
+     * @param stream stream from which the vector is read
+     * @param vector vector to which the elements are appended
+     *
+     * @throws std::runtime_error if the input ends before the vector does
+     * @note if the vector cannot be read, only the completely read chunks are left appended
+     */
+    template<typename Value, typename Allocator, typename GrowthPolicy, typename SizeType>
+    void readFrom(std::istream& stream, Vector<Value, Allocator, GrowthPolicy, SizeType>& vector) {
+        io::ChunkReader<io::StreamSource>(io::StreamSource(stream)).readAll(vector);
+    }
+} // namespace collection
+
+#endif //INCLUDE_VECTOR_IO_H_
@@ -0,0 +1,189 @@
+#ifndef INCLUDE_VECTOR_REF_H_
+#define INCLUDE_VECTOR_REF_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <checks.h>
+#include <simd.h>
+
+namespace collection {
+
+    /**
+     * @brief Non-owning reference to contiguously stored elements of any vector
+     * allowing {@link Vector}, {@link SmallVector} and {@link MappedVector} to be passed through the same interface
+     * without copying the elements
+     *
+     * @tparam Value type of referenced value, it is const-qualified for read-only references
+     *
+     * @note {@link VectorView} and {@link MutableVectorView} should be preferred as they tell the intent
+     */
+    template<typename Value>
+    class VectorRef {
+    public:
+        typedef Value ValueType;
+        typedef typename std::remove_const<Value>::type value_type;
+        typedef Value& reference;
+        typedef Value* Pointer;
+        typedef Pointer Iterator;
+
+    protected:
+        Pointer data_;
+        size_t size_;
+
+        inline void checkRange(size_t const index) const {
+            if (index >= size_) detail::throwOutOfRange(index, size_);
+        }
+
+        /**
+         * @brief Checks the index passed to the unchecked accessors if {@code COLLECTION_VECTOR_CHECKS} is at least 2
+         * @param index index of the accessed element
+         */
+        inline void checkAccess(size_t const index) const {
+#if COLLECTION_VECTOR_CHECKS >= 2
+            checkRange(index);
+#else
+            static_cast<void>(index);
+#endif
+        }
+
+    public:
+        constexpr VectorRef() noexcept : data_(nullptr), size_(0) {}
+
+        constexpr VectorRef(Pointer const data, size_t const size) noexcept : data_(data), size_(size) {}
+
+        /**
+         * @brief Creates a reference to the elements of the container
+         * @tparam Container type of the container providing {@code data()} and {@code size()}
+         * @param container container whose elements get referenced
+         */
+        template<typename Container, typename = typename std::enable_if<std::is_convertible<
+                                             decltype(std::declval<Container&>().data()), Pointer>::value>::type>
+        VectorRef(Container& container) noexcept : data_(container.data()), size_(container.size()) {}
+
+        /**
+         * @brief Converts the reference to mutable elements to the read-only one
+         * @param other reference to the same elements
+         */
+        template<typename Other, typename = typename std::enable_if<std::is_convertible<Other*, Pointer>::value>::type>
+        constexpr VectorRef(VectorRef<Other> const& other) noexcept : data_(other.data()), size_(other.size()) {}
+
+        /* ********************************************* Indexed access ********************************************* */
+
+        reference operator[](size_t const index) const {
+            checkAccess(index);
+
+            return data_[index];
+        }
+
+        reference at(size_t const index) const {
+            checkRange(index);
+
+            return data_[index];
+        }
+
+        /* ***************************************** Iterators and pointers ***************************************** */
+
+        constexpr Iterator begin() const { return data_; }
+
+        constexpr Iterator end() const { return data_ + size_; }
+
+        constexpr Pointer data() const { return data_; }
+
+        /* ********************************************* Data accessors ********************************************* */
+
+        constexpr bool empty() const noexcept { return size_ == 0; }
+
+        constexpr size_t size() const noexcept { return size_; }
+
+        /* ************************************************* Slicing ************************************************ */
+
+        /**
+         * @brief Creates a reference to the part of the referenced elements.
+         * @param offset index of the first element of the part
+         * @param count maximal number of elements in the part, it gets limited by the referenced elements
+         * @return reference to at most {@code count} elements starting at {@code offset}
+         *
+         * @throws std::out_of_range if {@code offset} is greater than the size
+         */
+        VectorRef subview(size_t const offset, size_t const count = static_cast<size_t>(-1)) const {
+            if (offset > size_) detail::throwOffsetOutOfRange(offset, size_);
+
+            return VectorRef(data_ + offset, std::min(count, size_ - offset));
+        }
+
+        /* ************************************************* Search ************************************************* */
+
+        /**
+         * @brief Finds the first element equal to the value.
+         * @param value searched value
+         * @return iterator pointing to the found element or {@link #end()} if there is none
+         *
+         * @note integral elements are compared by vector instructions
+         */
+        Iterator find(value_type const& value) const { return data_ + simd::find(data_, size_, value); }
+
+        /**
+         * @brief Counts the elements equal to the value.
+         * @param value counted value
+         * @return number of the elements equal to {@code value}
+         */
+        size_t count(value_type const& value) const { return simd::count(data_, size_, value); }
+
+        /**
+         * @brief Tells whether there is an element equal to the value.
+         * @param value searched value
+         */
+        bool contains(value_type const& value) const { return find(value) != end(); }
+    };
+
+    /**
+     * @brief Read-only view of contiguously stored elements
+     * @tparam Value type of viewed value
+     */
+    template<typename Value>
+    using VectorView = VectorRef<Value const>;
+
+    /**
+     * @brief View of contiguously stored elements allowing their modification
+     * @tparam Value type of viewed value
+     */
+    template<typename Value>
+    using MutableVectorView = VectorRef<Value>;
+
+    /* ************************************************* Comparison ************************************************* */
+
+    template<typename Value>
+    bool operator==(VectorRef<Value> const& left, VectorRef<Value> const& right) {
+        return left.size() == right.size() && simd::mismatch(left.data(), right.data(), left.size()) == left.size();
+    }
+
+    template<typename Value>
+    bool operator!=(VectorRef<Value> const& left, VectorRef<Value> const& right) {
+        return !(left == right);
+    }
+
+    template<typename Value>
+    bool operator<(VectorRef<Value> const& left, VectorRef<Value> const& right) {
+        return simd::compare(left.data(), left.size(), right.data(), right.size()) < 0;
+    }
+
+    template<typename Value>
+    bool operator<=(VectorRef<Value> const& left, VectorRef<Value> const& right) {
+        return simd::compare(left.data(), left.size(), right.data(), right.size()) <= 0;
+    }
+
+    template<typename Value>
+    bool operator>(VectorRef<Value> const& left, VectorRef<Value> const& right) {
+        return simd::compare(left.data(), left.size(), right.data(), right.size()) > 0;
+    }
+
+    template<typename Value>
+    bool operator>=(VectorRef<Value> const& left, VectorRef<Value> const& right) {
+        return simd::compare(left.data(), left.size(), right.data(), right.size()) >= 0;
+    }
+} // namespace collection
+
+#endif //INCLUDE_VECTOR_REF_H_
@@ -0,0 +1,218 @@
+#ifndef INCLUDE_VECTOR_STATS_H_
+#define INCLUDE_VECTOR_STATS_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+namespace collection {
+
+    /**
+     * @brief Instrumentation of vectors' memory usage enabled by defining {@code COLLECTION_VECTOR_STATS}
+     *
+     * Each vector type gets its own counters which are registered in the global {@link Registry}
+     * once the first event of that type gets recorded.
+     */
+    namespace stats {
+
+        /**
+         * @brief Counters of a single vector type, all of them are updated with relaxed atomics
+         */
+        struct Counters {
+            /** number of growths of the array (including the ones performed in place) */
+            std::atomic<std::uint64_t> growths{0};
+            /** number of growths performed in place without relocation of the elements */
+            std::atomic<std::uint64_t> inPlaceGrowths{0};
+            /** number of shrinks of the array */
+            std::atomic<std::uint64_t> shrinks{0};
+            /** number of bytes of the elements relocated into the new arrays */
+            std::atomic<std::uint64_t> relocatedBytes{0};
+            /** biggest capacity (in bytes) reached by any vector */
+            std::atomic<std::uint64_t> peakCapacityBytes{0};
+            /** number of destroyed vectors whose memory has been accounted below */
+            std::atomic<std::uint64_t> destroyedVectors{0};
+            /** total capacity (in bytes) of the destroyed vectors at their destruction */
+            std::atomic<std::uint64_t> destroyedCapacityBytes{0};
+            /** total unused capacity (in bytes) of the destroyed vectors at their destruction */
+            std::atomic<std::uint64_t> destroyedUnusedBytes{0};
+
+            /**
+             * @brief Calculates the part of the capacity left unused by the vectors at their destruction
+             * @return ratio between {@code 0} and {@code 1}
+             */
+            double wastedCapacityRatio() const noexcept {
+                auto const capacity = destroyedCapacityBytes.load(std::memory_order_relaxed);
+
+                return capacity == 0 ? 0 : static_cast<double>(destroyedUnusedBytes.load(std::memory_order_relaxed))
+                                                   / static_cast<double>(capacity);
+            }
+        };
+
+        /**
+         * @brief Global registry of the counters of all instrumented vector types
+         */
+        class Registry {
+            std::mutex mutex_;
+            std::vector<std::pair<std::string, Counters const*>> entries_;
+
+            Registry() = default;
+
+            template<typename Function>
+            void forEach(Function function) {
+                std::lock_guard<std::mutex> const lock(mutex_);
+                for (auto const& entry : entries_) function(entry.first, *entry.second);
+            }
+
+            static void writeEscaped(std::ostream& output, std::string const& text) {
+                for (auto const character : text) {
+                    if (character == '"' || character == '\\') output << '\\' << character;
+                    else if (character == '\n') output << "\\n";
+                    else output << character;
+                }
+            }
+
+        public:
+            static Registry& instance() {
+                static Registry registry;
+
+                return registry;
+            }
+
+            /**
+             * @brief Registers the counters so that they get dumped
+             * @param name name of the vector type
+             * @param counters counters which should live until the end of the program
+             */
+            void add(std::string name, Counters const& counters) {
+                std::lock_guard<std::mutex> const lock(mutex_);
+                entries_.emplace_back(std::move(name), &counters);
+            }
+
+            /**
+             * @brief Writes all counters as a JSON array of objects
+             * @param output stream to which the counters get written
+             */
+            void dumpJson(std::ostream& output) {
+                output << '[';
+                auto first = true;
+                forEach([&output, &first](std::string const& name, Counters const& counters) {
+                    if (!first) output << ',';
+                    first = false;
+
+                    output << "{\"type\":\"";
+                    writeEscaped(output, name);
+                    output << "\",\"growths\":" << counters.growths.load(std::memory_order_relaxed)
+                           << ",\"inPlaceGrowths\":" << counters.inPlaceGrowths.load(std::memory_order_relaxed)
+                           << ",\"shrinks\":" << counters.shrinks.load(std::memory_order_relaxed)
+                           << ",\"relocatedBytes\":" << counters.relocatedBytes.load(std::memory_order_relaxed)
+                           << ",\"peakCapacityBytes\":" << counters.peakCapacityBytes.load(std::memory_order_relaxed)
+                           << ",\"destroyedVectors\":" << counters.destroyedVectors.load(std::memory_order_relaxed)
+                           << ",\"wastedCapacityRatio\":" << counters.wastedCapacityRatio() << '}';
+                });
+                output << ']';
+            }
+
+            /**
+             * @brief Writes all counters in the Prometheus text exposition format
+             * @param output stream to which the counters get written
+             */
+            void dumpPrometheus(std::ostream& output) {
+                struct Metric {
+                    char const* name;
+                    char const* type;
+                    std::atomic<std::uint64_t> Counters::*counter;
+                };
+                static Metric const metrics[] = {
+                        {"collection_vector_growths_total", "counter", &Counters::growths},
+                        {"collection_vector_in_place_growths_total", "counter", &Counters::inPlaceGrowths},
+                        {"collection_vector_shrinks_total", "counter", &Counters::shrinks},
+                        {"collection_vector_relocated_bytes_total", "counter", &Counters::relocatedBytes},
+                        {"collection_vector_peak_capacity_bytes", "gauge", &Counters::peakCapacityBytes},
+                        {"collection_vector_destroyed_total", "counter", &Counters::destroyedVectors},
+                };
+
+                for (auto const& metric : metrics) {
+                    output << "# TYPE " << metric.name << ' ' << metric.type << '\n';
+                    forEach([&output, &metric](std::string const& name, Counters const& counters) {
+                        output << metric.name << "{type=\"";
+                        writeEscaped(output, name);
+                        output << "\"} " << (counters.*metric.counter).load(std::memory_order_relaxed) << '\n';
+                    });
+                }
+                output << "# TYPE collection_vector_wasted_capacity_ratio gauge\n";
+                forEach([&output](std::string const& name, Counters const& counters) {
+                    output << "collection_vector_wasted_capacity_ratio{type=\"";
+                    writeEscaped(output, name);
+                    output << "\"} " << counters.wastedCapacityRatio() << '\n';
+                });
+            }
+        };
+
+        /**
+         * @brief Gets the readable name of the type
+         */
+        template<typename Type>
+        std::string typeName() {
+            auto const name = typeid(Type).name();
+#if defined(__GNUG__)
+            int status = 0;
+            std::unique_ptr<char, void (*)(void*)> const demangled(abi::__cxa_demangle(name, nullptr, nullptr, &status),
+                                                                   std::free);
+            if (status == 0 && demangled != nullptr) return demangled.get();
+#endif
+            return name;
+        }
+
+        /**
+         * @brief Gets the counters of the vector type registering them on first use
+         * @tparam Vector type of the instrumented vector
+         */
+        template<typename Vector>
+        Counters& countersOf() {
+            static Counters* const counters = [] {
+                auto const created = new Counters(); // never destroyed so that it may be dumped at exit
+                Registry::instance().add(typeName<Vector>(), *created);
+
+                return created;
+            }();
+
+            return *counters;
+        }
+
+        inline void recordGrowth(Counters& counters, size_t const newCapacityBytes, size_t const relocatedBytes,
+                                 bool const inPlace) noexcept {
+            counters.growths.fetch_add(1, std::memory_order_relaxed);
+            if (inPlace) counters.inPlaceGrowths.fetch_add(1, std::memory_order_relaxed);
+            counters.relocatedBytes.fetch_add(relocatedBytes, std::memory_order_relaxed);
+
+            auto peak = counters.peakCapacityBytes.load(std::memory_order_relaxed);
+            while (peak < newCapacityBytes && !counters.peakCapacityBytes.compare_exchange_weak(
+                                                      peak, newCapacityBytes, std::memory_order_relaxed)) {}
+        }
+
+        inline void recordShrink(Counters& counters, size_t const relocatedBytes) noexcept {
+            counters.shrinks.fetch_add(1, std::memory_order_relaxed);
+            counters.relocatedBytes.fetch_add(relocatedBytes, std::memory_order_relaxed);
+        }
+
+        inline void recordDestruction(Counters& counters, size_t const capacityBytes, size_t const sizeBytes) noexcept {
+            counters.destroyedVectors.fetch_add(1, std::memory_order_relaxed);
+            counters.destroyedCapacityBytes.fetch_add(capacityBytes, std::memory_order_relaxed);
+            counters.destroyedUnusedBytes.fetch_add(capacityBytes - sizeBytes, std::memory_order_relaxed);
+        }
+    } // namespace stats
+} // namespace collection
+
+#endif //INCLUDE_VECTOR_STATS_H_
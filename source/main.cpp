@@ -1,6 +1,8 @@
 #include <iostream>
 
 #include <ostream>
+#include <string>
+#include <utility>
 #include <vector.h>
 
 class CustomStruct {
@@ -8,7 +10,7 @@ class CustomStruct {
     int number;
 
 public:
-    CustomStruct(std::string text, int number) : text(text), number(number) {}
+    CustomStruct(std::string text, int number) : text(std::move(text)), number(number) {}
 
     CustomStruct() : CustomStruct("default text", 0xCAFEBABE) {}
 
@@ -67,10 +69,10 @@ int main() {
         _VECTOR_SHOWCASE(vector, pushBack({"one hundred and twenty seven", 127}))
         _VECTOR_SHOWCASE(vector, popBack())
         _VECTOR_SHOWCASE(vector, popBack())
-        _VECTOR_SHOWCASE(vector, pushBack({"two", 2}))
-        _VECTOR_SHOWCASE(vector, pushBack({"four", 4}))
-        _VECTOR_SHOWCASE(vector, pushBack({"eight", 8}))
-        _VECTOR_SHOWCASE(vector, insert(vector.begin() + 2, {"ninety nine", 99}))
+        _VECTOR_SHOWCASE(vector, emplaceBack("two", 2))
+        _VECTOR_SHOWCASE(vector, emplaceBack("four", 4))
+        _VECTOR_SHOWCASE(vector, emplaceBack("eight", 8))
+        _VECTOR_SHOWCASE(vector, emplace(vector.begin() + 2, "ninety nine", 99))
         _VECTOR_SHOWCASE(vector, erase(vector.begin() + 1))
         _VECTOR_SHOWCASE(vector, erase(vector.begin() + 1, vector.begin() + 3))
         _VECTOR_SHOWCASE(vector, clear())